@@ -36,7 +36,7 @@ namespace jive
     {
         return find(root,
                     [id](const auto& element) {
-                        return fromVar<juce::Identifier>(element["id"]) == id;
+                        return fromVar<juce::Identifier>(element[ids::id]) == id;
                     });
     }
 } // namespace jive
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <jive_core/values/jive_TokenScanner.h>
+
 #include <juce_core/juce_core.h>
 
 namespace jive
@@ -96,31 +98,39 @@ namespace juce
 
         static jive::BorderRadii<Arithmetic> fromVar(const var& value)
         {
-            const auto tokens = juce::StringArray::fromTokens(value.toString(),
-                                                              " ",
-                                                              "");
+            const auto& text = value.toString();
+            std::array<Arithmetic, 4> radii{};
+            auto numTokens = 0;
+
+            for (jive::TokenScanner scanner{ text, " " };
+                 scanner.moveToNextToken();
+                 numTokens++)
+            {
+                if (numTokens < static_cast<int>(std::size(radii)))
+                    radii[static_cast<std::size_t>(numTokens)] = static_cast<Arithmetic>(scanner.getDoubleValue());
+            }
 
-            if (tokens.size() == 1)
+            if (numTokens == 1)
                 return {
-                    static_cast<Arithmetic>(tokens[0].getDoubleValue()),
+                    radii[0],
                 };
-            if (tokens.size() == 2)
+            if (numTokens == 2)
                 return {
-                    static_cast<Arithmetic>(tokens[0].getDoubleValue()),
-                    static_cast<Arithmetic>(tokens[1].getDoubleValue()),
+                    radii[0],
+                    radii[1],
                 };
-            if (tokens.size() == 3)
+            if (numTokens == 3)
                 return {
-                    static_cast<Arithmetic>(tokens[0].getDoubleValue()),
-                    static_cast<Arithmetic>(tokens[1].getDoubleValue()),
-                    static_cast<Arithmetic>(tokens[2].getDoubleValue()),
+                    radii[0],
+                    radii[1],
+                    radii[2],
                 };
-            if (tokens.size() >= 4)
+            if (numTokens >= 4)
                 return {
-                    static_cast<Arithmetic>(tokens[0].getDoubleValue()),
-                    static_cast<Arithmetic>(tokens[1].getDoubleValue()),
-                    static_cast<Arithmetic>(tokens[2].getDoubleValue()),
-                    static_cast<Arithmetic>(tokens[3].getDoubleValue()),
+                    radii[0],
+                    radii[1],
+                    radii[2],
+                    radii[3],
                 };
 
             return {};
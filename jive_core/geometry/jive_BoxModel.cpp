@@ -4,20 +4,19 @@ namespace jive
 {
     BoxModel::BoxModel(juce::ValueTree stateSource)
         : state{ stateSource }
-        , width{ state, "width" }
-        , height{ state, "height" }
-        , minWidth{ state, "min-width" }
-        , minHeight{ state, "min-height" }
-        , maxWidth{ state, "max-width" }
-        , maxHeight{ state, "max-height" }
-        , idealWidth{ state, "ideal-width" }
-        , idealHeight{ state, "ideal-height" }
-        , componentWidth{ state, "component-width" }
-        , componentHeight{ state, "component-height" }
-        , padding{ state, "padding" }
-        , border{ state, "border-width" }
-        , margin{ state, "margin" }
-        , callbackLock{ state, "box-model-callback-lock" }
+        , layoutState{ getLayoutState(state) }
+        , width{ state, ids::width }
+        , height{ state, ids::height }
+        , minWidth{ state, ids::minWidth }
+        , minHeight{ state, ids::minHeight }
+        , maxWidth{ state, ids::maxWidth }
+        , maxHeight{ state, ids::maxHeight }
+        , layoutProperties{ layoutState }
+        , componentWidth{ layoutState, ids::componentWidth }
+        , componentHeight{ layoutState, ids::componentHeight }
+        , padding{ state, ids::padding }
+        , border{ state, ids::borderWidth }
+        , margin{ state, ids::margin }
     {
         if (!width.exists())
             width.setAuto();
@@ -38,14 +37,14 @@ namespace jive
             listeners.call(&Listener::boxModelChanged, *this);
         };
         const auto onBoxModelChanged = [this, informBoxModelChanged]() {
-            if (callbackLock.get())
+            if (layoutProperties.get<LayoutSchema::callbackLock>())
                 return;
 
             informBoxModelChanged();
         };
         const auto handleOnValueChange = [this, informBoxModelChanged](auto& property, bool updateWidth, bool updateHeight) {
             property.onValueChange = [this, informBoxModelChanged, &property, updateWidth, updateHeight] {
-                if (callbackLock.get())
+                if (layoutProperties.get<LayoutSchema::callbackLock>())
                     return;
 
                 if (updateWidth && !width.isAuto())
@@ -71,8 +70,10 @@ namespace jive
         handleOnValueChange(maxWidth, false, false);
         handleOnValueChange(maxHeight, false, false);
 
-        idealWidth.onValueChange = onBoxModelChanged;
-        idealHeight.onValueChange = onBoxModelChanged;
+        layoutProperties.onValueChange = [onBoxModelChanged](std::size_t slot) {
+            if (slot != LayoutSchema::callbackLock)
+                onBoxModelChanged();
+        };
         componentWidth.onValueChange = [this, onBoxModelChanged]() {
             if (!componentWidth.isTransitioning())
                 onBoxModelChanged();
@@ -86,8 +87,8 @@ namespace jive
                 onBoxModelChanged();
         };
 
-        componentWidth.setTransitionSourceProperty(width.id);
-        componentHeight.setTransitionSourceProperty(height.id);
+        componentWidth.setTransitionSourceProperty(state, width.id);
+        componentHeight.setTransitionSourceProperty(state, height.id);
 
         componentWidth.onTransitionProgressed = informBoxModelChanged;
         componentHeight.onTransitionProgressed = informBoxModelChanged;
@@ -220,13 +221,24 @@ namespace jive
         const_cast<juce::ListenerList<Listener>*>(&listeners)->remove(&listener);
     }
 
+    Object::ReferenceCountedPointer BoxModel::getLayoutState(const juce::ValueTree& tree)
+    {
+        if (auto hub = PropertyHub::getFor(tree))
+            return hub->getNativeState();
+
+        return new Object;
+    }
+
     juce::Rectangle<float> BoxModel::getParentBounds() const
     {
         if (state.getParent().isValid())
         {
-            const Property<float> parentWidth{ state.getParent(), componentWidth.id };
-            const Property<float> parentHeight{ state.getParent(), componentHeight.id };
-            return { parentWidth.get(), parentHeight.get() };
+            const auto parentState = getLayoutState(state.getParent());
+
+            return {
+                fromVar<float>(parentState->getProperty(componentWidth.id)),
+                fromVar<float>(parentState->getProperty(componentHeight.id)),
+            };
         }
 
         return {};
@@ -245,12 +257,12 @@ namespace jive
 
     void BoxModel::lock()
     {
-        callbackLock = true;
+        layoutProperties.set<LayoutSchema::callbackLock>(true);
     }
 
     void BoxModel::unlock()
     {
-        callbackLock.clear();
+        layoutProperties.clear<LayoutSchema::callbackLock>();
     }
 } // namespace jive
 
@@ -274,6 +286,7 @@ public:
         testMargin();
         testContentBounds();
         testTransitions();
+        testLayoutState();
     }
 
 private:
@@ -563,6 +576,53 @@ private:
             expectWithinAbsoluteError(listener.callbackCount, 60, 1);
         }
     }
+
+    void testLayoutState()
+    {
+        beginTest("layout state");
+
+        struct TreeListener : public juce::ValueTree::Listener
+        {
+            void valueTreePropertyChanged(juce::ValueTree&, const juce::Identifier&) final
+            {
+                ++callbackCount;
+            }
+
+            int callbackCount = 0;
+        };
+
+        juce::ValueTree parentState{
+            "Component",
+            {},
+            {
+                juce::ValueTree{ "Component" },
+            },
+        };
+        jive::BoxModel parentBoxModel{ parentState };
+        jive::BoxModel boxModel{ parentState.getChild(0) };
+        TreeListener treeListener;
+        parentState.addListener(&treeListener);
+
+        parentBoxModel.setSize(200.0f, 100.0f);
+        boxModel.setSize(20.0f, 10.0f);
+        expectEquals(parentBoxModel.getOuterBounds(), juce::Rectangle{ 200.0f, 100.0f });
+        expectEquals(boxModel.getOuterBounds(), juce::Rectangle{ 20.0f, 10.0f });
+
+        const auto layoutState = jive::BoxModel::getLayoutState(parentState.getChild(0));
+        expectEquals(static_cast<float>(layoutState->getProperty("component-width")), 20.0f);
+        expectEquals(static_cast<float>(layoutState->getProperty("component-height")), 10.0f);
+
+        // Only the top-level width and height are written back to the tree.
+    #if !(JUCE_DEBUG && JIVE_MIRROR_NATIVE_STATE)
+        expectEquals(treeListener.callbackCount, 2);
+        expect(!parentState.getChild(0).hasProperty("component-width"));
+    #endif
+
+        parentState.getChild(0).setProperty("width", "50%", nullptr);
+        expectEquals(boxModel.getWidth(), 100.0f);
+
+        parentState.removeListener(&treeListener);
+    }
 };
 
 static BoxModelUnitTest boxModelUnitTest;
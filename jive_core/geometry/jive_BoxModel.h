@@ -2,6 +2,8 @@
 
 #include "jive_Length.h"
 
+#include <jive_core/values/jive_PropertySchema.h>
+
 #include <juce_gui_basics/juce_gui_basics.h>
 
 namespace jive
@@ -68,28 +70,50 @@ namespace jive
         void addListener(Listener& listener) const;
         void removeListener(Listener& listener) const;
 
+        /** Returns the object that holds the values derived while laying out
+            the given tree - its "component-width", "component-height",
+            "ideal-width" and "ideal-height". These are kept out of the tree
+            itself as they change far too often to be worth notifying every
+            one of its listeners about.
+        */
+        [[nodiscard]] static Object::ReferenceCountedPointer getLayoutState(const juce::ValueTree& tree);
+
         juce::ValueTree state;
 
     private:
+        struct LayoutSchema
+        {
+            enum Slot
+            {
+                idealWidth,
+                idealHeight,
+                callbackLock,
+            };
+
+            static constexpr auto entries = std::make_tuple(
+                PropertySchemaEntry<float>{ "ideal-width" },
+                PropertySchemaEntry<float>{ "ideal-height" },
+                PropertySchemaEntry<bool>{ "box-model-callback-lock" });
+        };
+
         void lock();
         void unlock();
 
         juce::Rectangle<float> getParentBounds() const;
 
+        Object::ReferenceCountedPointer layoutState;
         Length width;
         Length height;
         Length minWidth;
         Length minHeight;
         Length maxWidth;
         Length maxHeight;
-        Property<float> idealWidth;
-        Property<float> idealHeight;
+        PropertyTable<LayoutSchema> layoutProperties;
         Property<float> componentWidth;
         Property<float> componentHeight;
         Property<juce::BorderSize<float>> padding;
         Property<juce::BorderSize<float>> border;
         Property<juce::BorderSize<float>> margin;
-        Property<bool> callbackLock;
 
         juce::ListenerList<Listener> listeners;
 
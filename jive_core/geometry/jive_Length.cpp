@@ -4,49 +4,109 @@
 
 namespace jive
 {
-    [[nodiscard]] float Length::toPixels(const juce::Rectangle<float>& parentBounds) const
+    [[nodiscard]] static Length::Unit parseUnit(const juce::String& text)
     {
-        const auto getCurrent = [this] {
-            if (auto* transition = getTransition())
-                return transition->calculateCurrent<float>();
+        if (text.isEmpty() || text.equalsIgnoreCase("auto"))
+            return Length::Unit::automatic;
+        if (text.endsWith("%"))
+            return Length::Unit::percent;
+        if (text.endsWithIgnoreCase("rem"))
+            return Length::Unit::rem;
+        if (text.endsWithIgnoreCase("em"))
+            return Length::Unit::em;
+
+        return Length::Unit::pixels;
+    }
 
-            return get().getFloatValue();
-        };
+    [[nodiscard]] float Length::toPixels(const juce::Rectangle<float>& parentBounds) const
+    {
+        const auto& length = getParsedLength();
 
-        if (isAuto())
+        if (length.unit == Unit::automatic)
             return pixelValueWhenAuto;
 
-        if (isPixels())
-            return getCurrent();
+        if (auto* transition = getTransition())
+            return resolve(transition->calculateCurrent<float>(), length.unit, parentBounds);
+
+        if (length.unit == Unit::pixels)
+            return length.value;
+
+        const auto fontSizeGeneration = PropertyHub::getFontSizeGeneration();
 
-        if (isPercent())
+        if (resolvedLength.has_value()
+            && resolvedLength->parentBounds == parentBounds
+            && resolvedLength->fontSizeGeneration == fontSizeGeneration)
         {
-            const auto scale = static_cast<double>(getCurrent()) * 0.01;
-            return static_cast<float>(scale * getRelativeParentLength(parentBounds.toDouble()));
+            return resolvedLength->pixels;
         }
 
-        const auto fontSize = isRem() ? getRootFontSize() : getFontSize();
-        return fontSize * getCurrent();
+        const auto pixels = resolve(length.value, length.unit, parentBounds);
+        resolvedLength = ResolvedLength{ parentBounds, fontSizeGeneration, pixels };
+        return pixels;
+    }
+
+    [[nodiscard]] Length::Unit Length::getUnit() const
+    {
+        return getParsedLength().unit;
     }
 
     [[nodiscard]] bool Length::isPixels() const
     {
-        return !isAuto() && !isPercent() && !isEm() && !isRem();
+        return getUnit() == Unit::pixels;
     }
 
     [[nodiscard]] bool Length::isPercent() const
     {
-        return !isAuto() && toString().endsWith("%");
+        return getUnit() == Unit::percent;
     }
 
     [[nodiscard]] bool Length::isEm() const
     {
-        return !isAuto() && !isRem() && toString().endsWithIgnoreCase("em");
+        return getUnit() == Unit::em;
     }
 
     [[nodiscard]] bool Length::isRem() const
     {
-        return !isAuto() && toString().endsWithIgnoreCase("rem");
+        return getUnit() == Unit::rem;
+    }
+
+    [[nodiscard]] const Length::ParsedLength& Length::getParsedLength() const
+    {
+        // Copies of an unchanged value share the same text, so comparing the
+        // text's address is enough to tell whether it needs parsing again.
+        if (const auto text = get();
+            text.getCharPointer() != parsedLength.text.getCharPointer())
+        {
+            const auto trimmed = text.trim();
+            parsedLength = ParsedLength{
+                text,
+                trimmed.getFloatValue(),
+                parseUnit(trimmed),
+            };
+            resolvedLength.reset();
+        }
+
+        return parsedLength;
+    }
+
+    [[nodiscard]] float Length::resolve(float value, Unit unit, const juce::Rectangle<float>& parentBounds) const
+    {
+        switch (unit)
+        {
+        case Unit::automatic:
+            return pixelValueWhenAuto;
+        case Unit::pixels:
+            return value;
+        case Unit::percent:
+            return static_cast<float>(static_cast<double>(value) * 0.01 * getRelativeParentLength(parentBounds.toDouble()));
+        case Unit::em:
+            return getFontSize() * value;
+        case Unit::rem:
+            return getRootFontSize() * value;
+        }
+
+        jassertfalse;
+        return pixelValueWhenAuto;
     }
 
     [[nodiscard]] double Length::getRelativeParentLength(const juce::Rectangle<double>& parentBounds) const
@@ -62,13 +122,13 @@ namespace jive
     [[nodiscard]] float Length::getFontSize() const
     {
         for (auto toSearch = source;
-             isValid(source);
-             toSearch = getParent(source))
+             isValid(toSearch);
+             toSearch = getParent(toSearch))
         {
-            if (const auto style = getVar(toSearch, "style");
+            if (const auto style = getVar(toSearch, ids::style);
                 style.isObject())
             {
-                if (const auto fontSize = style["font-size"];
+                if (const auto fontSize = style[ids::fontSize];
                     fontSize != juce::var{})
                 {
                     return fromVar<float>(fontSize);
@@ -81,10 +141,10 @@ namespace jive
 
     [[nodiscard]] float Length::getRootFontSize() const
     {
-        if (const auto style = getVar(getRoot(source), "style");
+        if (const auto style = getVar(getRoot(source), ids::style);
             style.isObject())
         {
-            if (const auto fontSize = style["font-size"];
+            if (const auto fontSize = style[ids::fontSize];
                 fontSize != juce::var{})
             {
                 return fromVar<float>(fontSize);
@@ -112,6 +172,7 @@ public:
         testPercent();
         testEm();
         testRem();
+        testCaching();
     }
 
 private:
@@ -232,6 +293,71 @@ private:
         expect(width.isRem());
         expectEquals(width.toPixels({}), 40.0f);
     }
+
+    void testCaching()
+    {
+        beginTest("caching");
+
+        auto style = new jive::Object{
+            { "font-size", 10 },
+        };
+        juce::ValueTree state{
+            "Component",
+            {
+                { "style", style },
+            },
+            {
+                juce::ValueTree{
+                    "Component",
+                    {
+                        { "width", "50%" },
+                        { "height", "2em" },
+                    },
+                },
+            },
+        };
+        jive::Length width{ state.getChild(0), "width" };
+        jive::Length height{ state.getChild(0), "height" };
+        expect(width.getUnit() == jive::Length::Unit::percent);
+        expect(height.getUnit() == jive::Length::Unit::em);
+        expectEquals(width.toPixels({ 100.0f, 50.0f }), 50.0f);
+        expectEquals(width.toPixels({ 100.0f, 50.0f }), 50.0f);
+        expectEquals(width.toPixels({ 60.0f, 50.0f }), 30.0f);
+        expectEquals(height.toPixels({}), 20.0f);
+
+        width = "25%";
+        expectEquals(width.toPixels({ 60.0f, 50.0f }), 15.0f);
+
+        style->setProperty("font-size", 12);
+        expectEquals(height.toPixels({}), 24.0f);
+
+        state.setProperty("style",
+                          new jive::Object{
+                              { "font-size", 8 },
+                          },
+                          nullptr);
+        expectEquals(height.toPixels({}), 16.0f);
+
+        juce::ValueTree newParent{
+            "Component",
+            {
+                {
+                    "style",
+                    new jive::Object{
+                        { "font-size", 5 },
+                    },
+                },
+            },
+        };
+        auto child = state.getChild(0);
+        state.removeChild(child, nullptr);
+        newParent.appendChild(child, nullptr);
+        expectEquals(height.toPixels({}), 10.0f);
+
+        height = "auto";
+        expect(height.getUnit() == jive::Length::Unit::automatic);
+        expectEquals(height.toPixels({}), jive::Length::pixelValueWhenAuto);
+    }
 };
 
 static LengthUnitTest lengthUnitTest;
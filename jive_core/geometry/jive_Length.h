@@ -9,11 +9,21 @@ namespace jive
     class Length : public Property<juce::String>
     {
     public:
+        enum class Unit
+        {
+            automatic,
+            pixels,
+            percent,
+            em,
+            rem,
+        };
+
         using Property<juce::String>::Property;
         using Property<juce::String>::operator=;
 
         [[nodiscard]] float toPixels(const juce::Rectangle<float>& parentBounds) const;
 
+        [[nodiscard]] Unit getUnit() const;
         [[nodiscard]] bool isPixels() const;
         [[nodiscard]] bool isPercent() const;
         [[nodiscard]] bool isEm() const;
@@ -22,8 +32,27 @@ namespace jive
         static constexpr auto pixelValueWhenAuto = 0.0f;
 
     private:
+        struct ParsedLength
+        {
+            juce::String text;
+            float value = 0.0f;
+            Unit unit = Unit::automatic;
+        };
+
+        struct ResolvedLength
+        {
+            juce::Rectangle<float> parentBounds;
+            std::uint64_t fontSizeGeneration = 0;
+            float pixels = 0.0f;
+        };
+
+        [[nodiscard]] const ParsedLength& getParsedLength() const;
+        [[nodiscard]] float resolve(float value, Unit unit, const juce::Rectangle<float>& parentBounds) const;
         [[nodiscard]] double getRelativeParentLength(const juce::Rectangle<double>& parentBounds) const;
         [[nodiscard]] float getFontSize() const;
         [[nodiscard]] float getRootFontSize() const;
+
+        mutable ParsedLength parsedLength;
+        mutable std::optional<ResolvedLength> resolvedLength;
     };
 } // namespace jive
@@ -2,22 +2,20 @@
 
 namespace juce
 {
-    const Array<var> VariantConverter<jive::Orientation>::options = {
+    const jive::EnumNames<jive::Orientation> VariantConverter<jive::Orientation>::names = {
         "horizontal",
         "vertical",
     };
 
     jive::Orientation VariantConverter<jive::Orientation>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<jive::Orientation>(options.indexOf(v));
+        const auto value = names.find(v);
+        jassert(value.has_value());
+        return value.value_or(jive::Orientation{});
     }
 
     var VariantConverter<jive::Orientation>::toVar(const jive::Orientation& orientation)
     {
-        const auto index = static_cast<int>(orientation);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return names.toVar(orientation);
     }
 } // namespace juce
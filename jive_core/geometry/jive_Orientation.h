@@ -1,5 +1,7 @@
 #pragma once
 
+#include <jive_core/values/variant-converters/jive_EnumNames.h>
+
 #include <juce_data_structures/juce_data_structures.h>
 
 namespace jive
@@ -21,6 +23,6 @@ namespace juce
         static var toVar(const jive::Orientation& orientation);
 
     private:
-        static const Array<var> options;
+        static const jive::EnumNames<jive::Orientation> names;
     };
 } // namespace juce
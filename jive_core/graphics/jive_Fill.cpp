@@ -61,7 +61,7 @@ namespace juce
         if (v.isString())
             return jive::Fill{ VariantConverter<Colour>::fromVar(v) };
 
-        if (v.hasProperty("gradient"))
+        if (v.hasProperty(jive::ids::gradient))
             return jive::Fill{ VariantConverter<jive::Gradient>::fromVar(v) };
 
         return jive::Fill{ Colour{} };
@@ -2,8 +2,26 @@
 
 #include <jive_core/compile-time-helpers/jive_JuceVersion.h>
 
+#include <juce_events/juce_events.h>
+
 namespace jive
 {
+    bool FontAttributes::operator==(const FontAttributes& other) const
+    {
+        return family == other.family
+            && juce::exactlyEqual(size, other.size)
+            && style == other.style
+            && weight == other.weight
+            && juce::exactlyEqual(letterSpacing, other.letterSpacing)
+            && juce::exactlyEqual(stretch, other.stretch)
+            && decoration == other.decoration;
+    }
+
+    bool FontAttributes::operator!=(const FontAttributes& other) const
+    {
+        return !(*this == other);
+    }
+
     int parseFontStyleFlags(const juce::String& styleString)
     {
         int flags = juce::Font::plain;
@@ -27,4 +45,146 @@ namespace jive
         return font.getStringWidthFloat(text);
 #endif
     }
+
+    juce::Font createFont(const FontAttributes& attributes)
+    {
+        juce::Font font{
+#if JUCE_MAJOR_VERSION >= 8
+            juce::FontOptions{},
+#endif
+        };
+
+        font.setTypefaceName(attributes.family);
+
+        if (juce::Font::getDefaultTypefaceForFont(font) == nullptr)
+            return font;
+
+        font.setItalic(attributes.style == "italic");
+        font.setBold(attributes.weight == "bold");
+        font = font.withPointHeight(attributes.size);
+        font.setExtraKerningFactor(attributes.letterSpacing / font.getHeight());
+        font.setUnderline(attributes.decoration == "underlined");
+        font.setHorizontalScale(attributes.stretch);
+
+        return font;
+    }
+
+    struct FontAttributesHash
+    {
+        [[nodiscard]] std::size_t operator()(const FontAttributes& attributes) const noexcept
+        {
+            auto result = static_cast<std::size_t>(attributes.family.hash());
+            const auto combine = [&result](std::size_t hash) {
+                result ^= hash + 0x9e3779b9 + (result << 6) + (result >> 2);
+            };
+
+            combine(std::hash<float>{}(attributes.size));
+            combine(static_cast<std::size_t>(attributes.style.hash()));
+            combine(static_cast<std::size_t>(attributes.weight.hash()));
+            combine(std::hash<float>{}(attributes.letterSpacing));
+            combine(std::hash<float>{}(attributes.stretch));
+            combine(static_cast<std::size_t>(attributes.decoration.hash()));
+
+            return result;
+        }
+    };
+
+    // Fonts keep their typefaces alive, so the cache needs clearing before
+    // JUCE shuts down its typeface backends rather than at static
+    // destruction.
+    class FontCache : private juce::DeletedAtShutdown
+    {
+    public:
+        ~FontCache()
+        {
+            clearSingletonInstance();
+        }
+
+        [[nodiscard]] std::optional<juce::Font> find(const FontAttributes& attributes) const
+        {
+            const juce::SpinLock::ScopedLockType scopedLock{ lock };
+
+            if (const auto cached = fonts.find(attributes);
+                cached != std::end(fonts))
+            {
+                return cached->second;
+            }
+
+            return std::nullopt;
+        }
+
+        void add(const FontAttributes& attributes, const juce::Font& font)
+        {
+            const juce::SpinLock::ScopedLockType scopedLock{ lock };
+
+            // Transitioning sizes and spacings would otherwise fill the cache
+            // with fonts that are only used for a single frame.
+            if (std::size(fonts) < maxNumFonts)
+                fonts.emplace(attributes, font);
+        }
+
+        JUCE_DECLARE_SINGLETON(FontCache, false)
+
+    private:
+        static constexpr auto maxNumFonts = 512;
+
+        mutable juce::SpinLock lock;
+        std::unordered_map<FontAttributes, juce::Font, FontAttributesHash> fonts;
+    };
+
+    JUCE_IMPLEMENT_SINGLETON(FontCache)
+
+    juce::Font getCachedFont(const FontAttributes& attributes)
+    {
+        auto& cache = *FontCache::getInstance();
+
+        if (auto cached = cache.find(attributes))
+            return *cached;
+
+        // Copies of a font share its typeface once it's been looked up, so
+        // looking it up here means none of them have to.
+        const auto font = createFont(attributes);
+        juce::ignoreUnused(font.getTypefacePtr());
+        cache.add(attributes, font);
+
+        return font;
+    }
 } // namespace jive
+
+#if JIVE_UNIT_TESTS
+class FontUtilitiesTest : public juce::UnitTest
+{
+public:
+    FontUtilitiesTest()
+        : juce::UnitTest{ "jive::FontUtilities", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testCachedFonts();
+    }
+
+private:
+    void testCachedFonts()
+    {
+        beginTest("cached fonts");
+
+        jive::FontAttributes attributes;
+        attributes.family = juce::Font::getDefaultSansSerifFontName();
+        attributes.size = 20.0f;
+        attributes.weight = "bold";
+
+        const auto font = jive::getCachedFont(attributes);
+        expect(font == jive::createFont(attributes));
+        expect(jive::getCachedFont(attributes) == font);
+        expect(font.getTypefacePtr() != nullptr);
+        expect(jive::getCachedFont(attributes).getTypefacePtr() == font.getTypefacePtr());
+
+        attributes.size = 30.0f;
+        expect(jive::getCachedFont(attributes) == jive::createFont(attributes));
+    }
+};
+
+static FontUtilitiesTest fontUtilitiesTest;
+#endif
@@ -4,6 +4,33 @@
 
 namespace jive
 {
+    /** Everything that decides which font a piece of styled text is drawn
+        with.
+    */
+    struct FontAttributes
+    {
+        [[nodiscard]] bool operator==(const FontAttributes& other) const;
+        [[nodiscard]] bool operator!=(const FontAttributes& other) const;
+
+        juce::String family;
+        float size = 14.0f;
+        juce::String style;
+        juce::String weight;
+        float letterSpacing = 0.0f;
+        float stretch = 1.0f;
+        juce::String decoration;
+    };
+
     [[nodiscard]] int parseFontStyleFlags(const juce::String& styleString);
     [[nodiscard]] float calculateStringWidth(const juce::String& text, const juce::Font& font);
+
+    [[nodiscard]] juce::Font createFont(const FontAttributes& attributes);
+
+    /** Returns a font with the given attributes, with its typeface already
+        looked up.
+
+        Fonts are shared by every caller in the process, so only the first
+        request for a particular set of attributes pays for the lookup.
+    */
+    [[nodiscard]] juce::Font getCachedFont(const FontAttributes& attributes);
 } // namespace jive
@@ -132,25 +132,25 @@ namespace juce
     {
         auto object = std::make_unique<DynamicObject>();
 
-        object->setProperty("stops",
+        object->setProperty(jive::ids::stops,
                             VariantConverter<Array<jive::Gradient::ColourStop>>::toVar(gradient.stops));
-        object->setProperty("gradient",
+        object->setProperty(jive::ids::gradient,
                             VariantConverter<jive::Gradient::Variant>::toVar(gradient.variant));
 
         if (gradient.orientation.hasValue())
         {
             jassert(!gradient.startEndPoints.hasValue());
 
-            object->setProperty("orientation",
+            object->setProperty(jive::ids::orientation,
                                 VariantConverter<jive::Orientation>::toVar(*gradient.orientation));
         }
         else if (gradient.startEndPoints.hasValue())
         {
             jassert(!gradient.orientation.hasValue());
 
-            object->setProperty("start",
+            object->setProperty(jive::ids::start,
                                 VariantConverter<Point<float>>::toVar(gradient.startEndPoints->getStart()));
-            object->setProperty("end",
+            object->setProperty(jive::ids::end,
                                 VariantConverter<Point<float>>::toVar(gradient.startEndPoints->getEnd()));
         }
 
@@ -163,18 +163,18 @@ namespace juce
 
         jive::Gradient gradient;
 
-        gradient.stops = VariantConverter<Array<jive::Gradient::ColourStop>>::fromVar(value["stops"]);
-        gradient.variant = VariantConverter<jive::Gradient::Variant>::fromVar(value["gradient"]);
+        gradient.stops = VariantConverter<Array<jive::Gradient::ColourStop>>::fromVar(value[jive::ids::stops]);
+        gradient.variant = VariantConverter<jive::Gradient::Variant>::fromVar(value[jive::ids::gradient]);
 
-        if (value.hasProperty("orientation"))
+        if (value.hasProperty(jive::ids::orientation))
         {
-            gradient.orientation = VariantConverter<jive::Orientation>::fromVar(value["orientation"]);
+            gradient.orientation = VariantConverter<jive::Orientation>::fromVar(value[jive::ids::orientation]);
         }
-        else if (value.hasProperty("start") || value.hasProperty("end"))
+        else if (value.hasProperty(jive::ids::start) || value.hasProperty(jive::ids::end))
         {
             gradient.startEndPoints = juce::Line<float>{
-                VariantConverter<Point<float>>::fromVar(value["start"]),
-                VariantConverter<Point<float>>::fromVar(value["end"]),
+                VariantConverter<Point<float>>::fromVar(value[jive::ids::start]),
+                VariantConverter<Point<float>>::fromVar(value[jive::ids::end]),
             };
         }
         else
@@ -4,8 +4,8 @@ namespace jive
 {
     ComponentInteractionState::ComponentInteractionState(const juce::Component& comp, juce::ValueTree tree)
         : component{ comp }
-        , mouse{ tree, "mouse" }
-        , keyboard{ tree, "keyboard" }
+        , mouse{ tree, ids::mouse }
+        , keyboard{ tree, ids::keyboard }
     {
         const_cast<juce::Component&>(component).addMouseListener(this, true);
         juce::Desktop::getInstance().addFocusChangeListener(this);
@@ -69,7 +69,7 @@ namespace jive
 
 namespace juce
 {
-    const std::unordered_map<jive::ComponentInteractionState::Mouse, juce::String> VariantConverter<jive::ComponentInteractionState::Mouse>::map{
+    const jive::EnumNames<jive::ComponentInteractionState::Mouse> VariantConverter<jive::ComponentInteractionState::Mouse>::names{
         { jive::ComponentInteractionState::Mouse::dissociate, "dissociate" },
         { jive::ComponentInteractionState::Mouse::hover, "hover" },
         { jive::ComponentInteractionState::Mouse::active, "active" },
@@ -77,7 +77,7 @@ namespace juce
 
     var VariantConverter<jive::ComponentInteractionState::Mouse>::toVar(const jive::ComponentInteractionState::Mouse& mouse)
     {
-        return map.find(mouse)->second;
+        return names.toVar(mouse);
     }
 
     jive::ComponentInteractionState::Mouse VariantConverter<jive::ComponentInteractionState::Mouse>::fromVar(const var& value)
@@ -85,17 +85,14 @@ namespace juce
         if (value.isVoid())
             return jive::ComponentInteractionState::Mouse::dissociate;
 
-        return std::find_if(std::begin(map),
-                            std::end(map),
-                            [value](auto&& pair) {
-                                return value.toString() == pair.second;
-                            })
-            ->first;
+        const auto mouse = names.find(value);
+        jassert(mouse.has_value());
+        return mouse.value_or(jive::ComponentInteractionState::Mouse::dissociate);
     }
 
     var VariantConverter<jive::ComponentInteractionState::Keyboard>::toVar(const jive::ComponentInteractionState::Keyboard& mouse)
     {
-        return map.find(mouse)->second;
+        return names.toVar(mouse);
     }
 
     jive::ComponentInteractionState::Keyboard VariantConverter<jive::ComponentInteractionState::Keyboard>::fromVar(const var& value)
@@ -103,15 +100,12 @@ namespace juce
         if (value.isVoid())
             return jive::ComponentInteractionState::Keyboard::dissociate;
 
-        return std::find_if(std::begin(map),
-                            std::end(map),
-                            [value](auto&& pair) {
-                                return value.toString() == pair.second;
-                            })
-            ->first;
+        const auto keyboard = names.find(value);
+        jassert(keyboard.has_value());
+        return keyboard.value_or(jive::ComponentInteractionState::Keyboard::dissociate);
     }
 
-    const std::unordered_map<jive::ComponentInteractionState::Keyboard, juce::String> VariantConverter<jive::ComponentInteractionState::Keyboard>::map{
+    const jive::EnumNames<jive::ComponentInteractionState::Keyboard> VariantConverter<jive::ComponentInteractionState::Keyboard>::names{
         { jive::ComponentInteractionState::Keyboard::dissociate, "dissociate" },
         { jive::ComponentInteractionState::Keyboard::focus, "focus" },
     };
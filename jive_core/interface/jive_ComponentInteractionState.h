@@ -53,7 +53,7 @@ namespace juce
         static jive::ComponentInteractionState::Mouse fromVar(const var&);
 
     private:
-        static const std::unordered_map<jive::ComponentInteractionState::Mouse, juce::String> map;
+        static const jive::EnumNames<jive::ComponentInteractionState::Mouse> names;
     };
     template <>
     class VariantConverter<jive::ComponentInteractionState::Keyboard>
@@ -63,6 +63,6 @@ namespace juce
         static jive::ComponentInteractionState::Keyboard fromVar(const var&);
 
     private:
-        static const std::unordered_map<jive::ComponentInteractionState::Keyboard, juce::String> map;
+        static const jive::EnumNames<jive::ComponentInteractionState::Keyboard> names;
     };
 } // namespace juce
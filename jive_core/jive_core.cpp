@@ -19,11 +19,18 @@
 #include "kinetics/jive_Transitions.cpp"
 #include "time/jive_Timer.cpp"
 #include "values/jive_Colours.cpp"
+#include "values/jive_Computed.cpp"
 #include "values/jive_Event.cpp"
 #include "values/jive_Object.cpp"
 #include "values/jive_Property.cpp"
+#include "values/jive_PropertyHub.cpp"
+#include "values/jive_PropertySchema.cpp"
+#include "values/jive_RealtimeValue.cpp"
+#include "values/jive_ScopedUpdateBatch.cpp"
+#include "values/jive_TokenScanner.cpp"
 #include "values/jive_XmlParser.cpp"
 #include "values/variant-converters/jive_AttributedStringVariantConverters.cpp"
+#include "values/variant-converters/jive_EnumNames.cpp"
 #include "values/variant-converters/jive_FlexVariantConverters.cpp"
 #include "values/variant-converters/jive_GridVariantConverters.cpp"
 #include "values/variant-converters/jive_VariantConvertion.cpp"
@@ -30,12 +30,21 @@ END_JUCE_MODULE_DECLARATION */
 #include "values/jive_PropertyBehaviours.h"
 
 #include "values/jive_Colours.h"
+#include "values/jive_Computed.h"
 #include "values/jive_Event.h"
+#include "values/jive_IdentifierHash.h"
+#include "values/jive_Identifiers.h"
 #include "values/jive_Object.h"
 #include "values/jive_Property.h"
+#include "values/jive_PropertyHub.h"
+#include "values/jive_PropertySchema.h"
+#include "values/jive_RealtimeValue.h"
 #include "values/jive_ReferenceCountedValueTreeWrapper.h"
+#include "values/jive_ScopedUpdateBatch.h"
+#include "values/jive_TokenScanner.h"
 #include "values/jive_XmlParser.h"
 #include "values/variant-converters/jive_AttributedStringVariantConverters.h"
+#include "values/variant-converters/jive_EnumNames.h"
 #include "values/variant-converters/jive_FlexVariantConverters.h"
 #include "values/variant-converters/jive_GridVariantConverters.h"
 #include "values/variant-converters/jive_MiscVariantConverters.h"
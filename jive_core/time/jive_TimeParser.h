@@ -1,13 +1,43 @@
 #pragma once
 
-#include <regex>
+#include <juce_core/juce_core.h>
 
 namespace jive
 {
+    // Matches one or more digits, optionally followed by a decimal point and
+    // one or more digits, followed by either "s" or "ms".
     [[nodiscard]] static auto isValidTimeString(const juce::String& str)
     {
-        static const std::regex timeDataTypeRegex{ R"(^(\d+(\.\d+)?)(s|ms)$)" };
-        return std::regex_match(str.toRawUTF8(), timeDataTypeRegex);
+        auto character = str.getCharPointer();
+
+        const auto skipDigits = [&character] {
+            auto numDigits = 0;
+
+            for (; juce::CharacterFunctions::isDigit(*character); ++character)
+                numDigits++;
+
+            return numDigits > 0;
+        };
+
+        if (!skipDigits())
+            return false;
+
+        if (*character == '.')
+        {
+            ++character;
+
+            if (!skipDigits())
+                return false;
+        }
+
+        if (*character == 'm')
+            ++character;
+
+        if (*character != 's')
+            return false;
+
+        ++character;
+        return character.isEmpty();
     }
 
     [[nodiscard, maybe_unused]] static std::optional<juce::RelativeTime> parseTime(const juce::String& timeString)
@@ -42,6 +42,21 @@ namespace jive
         : callback{ timerCallback }
         , interval{ callbackInterval }
     {
+        start();
+    }
+
+    Timer::~Timer()
+    {
+        stop();
+    }
+
+    void Timer::start()
+    {
+        if (running)
+            return;
+
+        running = true;
+
 #if JIVE_UNIT_TESTS
         timeLastCallbackInvoked = FakeTime::now();
         FakeTime::getInstance()->addListener(*this);
@@ -51,18 +66,30 @@ namespace jive
 #endif
     }
 
-    Timer::~Timer()
+    void Timer::stop()
     {
+        if (!running)
+            return;
+
+        running = false;
+
 #if JIVE_UNIT_TESTS
         FakeTime::getInstance()->removeListener(*this);
+#else
+        stopTimer();
 #endif
     }
 
+    bool Timer::isRunning() const noexcept
+    {
+        return running;
+    }
+
 #if JIVE_UNIT_TESTS
     void Timer::timeChanged()
     {
         for (auto elapsed = FakeTime::now() - timeLastCallbackInvoked;
-             elapsed.inMilliseconds() > interval.inMilliseconds();
+             running && elapsed.inMilliseconds() > interval.inMilliseconds();
              elapsed -= interval)
         {
             timeLastCallbackInvoked = FakeTime::now() - elapsed + interval;
@@ -116,6 +143,29 @@ public:
         expectEquals(invokeTimes[2], initialTime + juce::RelativeTime::seconds(5.6));
         expectEquals(invokeTimes[3], initialTime + juce::RelativeTime::seconds(5.7));
         expectEquals(invokeTimes[4], initialTime + juce::RelativeTime::seconds(5.8));
+
+        beginTest("stopping and restarting");
+        timer.stop();
+        expect(!timer.isRunning());
+        jive::FakeTime::incrementTime(juce::RelativeTime::seconds(0.5));
+        expectEquals(invokeTimes.size(), 5);
+
+        timer.start();
+        expect(timer.isRunning());
+        jive::FakeTime::incrementTime(juce::RelativeTime::seconds(0.15));
+        expectEquals(invokeTimes.size(), 6);
+
+        beginTest("stopping from within the callback");
+        auto numCallbacks = 0;
+        jive::Timer selfStoppingTimer{
+            [&numCallbacks, &selfStoppingTimer](juce::Time) {
+                numCallbacks++;
+                selfStoppingTimer.stop();
+            },
+            juce::RelativeTime::seconds(0.1),
+        };
+        jive::FakeTime::incrementTime(juce::RelativeTime::seconds(0.55));
+        expectEquals(numCallbacks, 1);
     }
 };
 
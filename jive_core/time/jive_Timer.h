@@ -48,6 +48,18 @@ namespace jive
               juce::RelativeTime callbackInterval);
         ~Timer();
 
+        /** Resumes callbacks after the timer was stopped. Timers start
+            running as soon as they're constructed.
+        */
+        void start();
+
+        /** Stops any further callbacks. Safe to call from within the
+            callback itself.
+        */
+        void stop();
+
+        [[nodiscard]] bool isRunning() const noexcept;
+
     private:
 #if JIVE_UNIT_TESTS
         void timeChanged() final;
@@ -58,6 +70,7 @@ namespace jive
         Callback callback;
         juce::RelativeTime interval;
         juce::Time timeLastCallbackInvoked;
+        bool running = false;
     };
 
     [[nodiscard]] static inline juce::Time now() noexcept
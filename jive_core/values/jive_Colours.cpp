@@ -1,67 +1,173 @@
 #include "jive_Colours.h"
+#include "jive_TokenScanner.h"
 
 namespace jive
 {
-    [[nodiscard]] static auto getTokensBetweenParentheses(const juce::String& text)
+    struct ColourArguments
     {
-        static constexpr auto includeSubString = false;
-        static constexpr auto ignoreCase = true;
-        const auto values = text.fromLastOccurrenceOf("(", includeSubString, ignoreCase)
-                                .upToFirstOccurrenceOf(")", includeSubString, ignoreCase);
-        return juce::StringArray::fromTokens(values, ",", "");
+        std::array<int, 4> intValues{};
+        std::array<float, 4> floatValues{};
+        int count = 0;
+    };
+
+    // Reads the comma-separated arguments between the last opening parenthesis
+    // and the closing one after it.
+    [[nodiscard]] static auto getArgumentsBetweenParentheses(const juce::String& text) noexcept
+    {
+        auto start = text.getCharPointer();
+        const auto end = start.findTerminatingNull();
+
+        for (auto character = start; character != end; ++character)
+        {
+            if (*character == '(')
+            {
+                start = character;
+                ++start;
+            }
+        }
+
+        auto argumentsEnd = start;
+
+        while (argumentsEnd != end && *argumentsEnd != ')')
+            ++argumentsEnd;
+
+        ColourArguments arguments;
+        TokenScanner scanner{ start, argumentsEnd, "," };
+
+        while (scanner.moveToNextToken())
+        {
+            if (const auto index = static_cast<std::size_t>(arguments.count);
+                index < std::size(arguments.intValues))
+            {
+                arguments.intValues[index] = scanner.getIntValue();
+                arguments.floatValues[index] = static_cast<float>(scanner.getDoubleValue());
+            }
+
+            arguments.count++;
+        }
+
+        return arguments;
     }
 
     [[nodiscard]] static auto parseRgbColourString(const juce::String& text)
     {
-        const auto tokens = getTokensBetweenParentheses(text);
-        jassert(tokens.size() >= 3);
+        const auto arguments = getArgumentsBetweenParentheses(text);
+        jassert(arguments.count >= 3);
 
-        const auto red = static_cast<juce::uint8>(tokens[0].getIntValue());
-        const auto green = static_cast<juce::uint8>(tokens[1].getIntValue());
-        const auto blue = static_cast<juce::uint8>(tokens[2].getIntValue());
-        const auto alpha = static_cast<juce::uint8>(juce::roundToInt(255.0f * (tokens.size() > 3 ? tokens[3].getFloatValue() : 1.0f)));
+        const auto red = static_cast<juce::uint8>(arguments.intValues[0]);
+        const auto green = static_cast<juce::uint8>(arguments.intValues[1]);
+        const auto blue = static_cast<juce::uint8>(arguments.intValues[2]);
+        const auto alpha = static_cast<juce::uint8>(juce::roundToInt(255.0f * (arguments.count > 3 ? arguments.floatValues[3] : 1.0f)));
 
         return juce::Colour::fromRGBA(red, green, blue, alpha);
     }
 
     [[nodiscard]] static auto parseHslColourString(const juce::String& text)
     {
-        const auto tokens = getTokensBetweenParentheses(text);
-        jassert(tokens.size() >= 3);
+        const auto arguments = getArgumentsBetweenParentheses(text);
+        jassert(arguments.count >= 3);
 
-        const auto hue = tokens[0].getFloatValue() / 360.0f;
-        const auto saturation = tokens[1].getFloatValue() / 100.0f;
-        const auto lightness = tokens[2].getFloatValue() / 100.0f;
-        const auto alpha = tokens.size() > 3 ? tokens[3].getFloatValue() : 1.0f;
+        const auto hue = arguments.floatValues[0] / 360.0f;
+        const auto saturation = arguments.floatValues[1] / 100.0f;
+        const auto lightness = arguments.floatValues[2] / 100.0f;
+        const auto alpha = arguments.count > 3 ? arguments.floatValues[3] : 1.0f;
 
         return juce::Colour::fromHSL(hue, saturation, lightness, alpha);
     }
 
-    [[nodiscard]] static auto parseHexColourString(juce::String text)
+    // Like juce::String::getHexValue32(), any characters that aren't hex digits
+    // are skipped.
+    [[nodiscard]] static auto parseHexByte(juce::juce_wchar first, juce::juce_wchar second) noexcept
     {
-        text = text.fromLastOccurrenceOf("#", false, true);
+        auto value = 0;
 
-        if (text.length() < 3 || text.length() == 5 || text.length() == 7)
-            return juce::Colour{};
+        for (const auto character : { first, second })
+        {
+            if (const auto digit = juce::CharacterFunctions::getHexDigitValue(character);
+                digit >= 0)
+            {
+                value = (value << 4) | digit;
+            }
+        }
+
+        return static_cast<juce::uint8>(value);
+    }
+
+    [[nodiscard]] static auto parseHexColourString(const juce::String& text)
+    {
+        auto digits = text.getCharPointer();
 
-        if (text.length() < 5)
+        for (auto character = digits; !character.isEmpty(); ++character)
         {
-            const auto length = text.length();
+            if (*character == '#')
+            {
+                digits = character;
+                ++digits;
+            }
+        }
 
-            for (auto i = length - 1; i >= 0; i--)
+        const auto length = static_cast<int>(digits.length());
+
+        if (length < 3 || length == 5 || length == 7)
+            return juce::Colour{};
+
+        // Short forms repeat each digit, and a missing alpha is opaque.
+        std::array<juce::juce_wchar, 8> expanded;
+        expanded.fill('F');
+
+        if (length < 5)
+        {
+            for (std::size_t i = 0; i < static_cast<std::size_t>(length); i++)
             {
-                const auto replacement = text.substring(i, i + 1) + text.substring(i, i + 1);
-                text = text.replaceSection(i, 1, replacement);
+                const auto digit = digits.getAndAdvance();
+                expanded[i * 2] = digit;
+                expanded[i * 2 + 1] = digit;
             }
         }
+        else
+        {
+            for (std::size_t i = 0; i < std::size(expanded) && !digits.isEmpty(); i++)
+                expanded[i] = digits.getAndAdvance();
+        }
+
+        return juce::Colour{
+            parseHexByte(expanded[0], expanded[1]),
+            parseHexByte(expanded[2], expanded[3]),
+            parseHexByte(expanded[4], expanded[5]),
+            parseHexByte(expanded[6], expanded[7]),
+        };
+    }
+
+    // Colours::findColourForName() converts the name to lower case before
+    // looking it up, so the result is remembered for the names that are
+    // actually used.
+    [[nodiscard]] static std::optional<juce::Colour> findNamedColour(const juce::String& name)
+    {
+        static constexpr auto maxNumRememberedNames = 256;
+        static juce::SpinLock lock;
+        static std::unordered_map<juce::String, std::optional<juce::Colour>> rememberedNames;
+
+        const juce::SpinLock::ScopedLockType scopedLock{ lock };
+
+        if (const auto remembered = rememberedNames.find(name);
+            remembered != std::end(rememberedNames))
+        {
+            return remembered->second;
+        }
 
-        text = text.paddedRight('F', 8);
-        const auto red = static_cast<juce::uint8>(text.substring(0, 2).getHexValue32());
-        const auto green = static_cast<juce::uint8>(text.substring(2, 4).getHexValue32());
-        const auto blue = static_cast<juce::uint8>(text.substring(4, 6).getHexValue32());
-        const auto alpha = static_cast<juce::uint8>(text.substring(6, 8).getHexValue32());
+        static const juce::Colour defaultIfNotFound{ 0x12345670 };
+        std::optional<juce::Colour> result;
 
-        return juce::Colour{ red, green, blue, alpha };
+        if (const auto colour = juce::Colours::findColourForName(name, defaultIfNotFound);
+            colour != defaultIfNotFound)
+        {
+            result = colour;
+        }
+
+        if (std::size(rememberedNames) < maxNumRememberedNames)
+            rememberedNames.emplace(name, result);
+
+        return result;
     }
 
     [[nodiscard]] juce::Colour parseColour(const juce::String& colourString)
@@ -73,12 +179,8 @@ namespace jive
         if (colourString.startsWith("#"))
             return parseHexColourString(colourString);
 
-        static const juce::Colour defaultIfNotFound{ 0x12345670 };
-        if (auto colour = juce::Colours::findColourForName(colourString, defaultIfNotFound);
-            colour != defaultIfNotFound)
-        {
-            return colour;
-        }
+        if (const auto colour = findNamedColour(colourString))
+            return *colour;
 
         return juce::Colour::fromString(colourString);
     }
@@ -98,6 +200,7 @@ public:
     void runTest() final
     {
         testRgbString();
+        testFuzzedStrings();
     }
 
 private:
@@ -116,6 +219,149 @@ private:
         expectEquals(jive::parseColour("hsl(120, 60%, 70%)"), juce::Colour{ 0xFF85E085 });
         expectEquals(jive::parseColour("hsla(280, 80%, 40%, 0.2)"), juce::Colour{ 0x338114B8 });
     }
+
+    void testFuzzedStrings()
+    {
+        beginTest("fuzzed strings");
+
+        juce::Random random{ 1234 };
+
+        for (auto i = 0; i < 5000; i++)
+        {
+            const auto text = generateColourString(random);
+            expectEquals(jive::parseColour(text), parseColourWithStringArrays(text), text);
+        }
+    }
+
+    [[nodiscard]] static juce::String generateNumber(juce::Random& random)
+    {
+        juce::String number;
+
+        if (random.nextInt(10) == 0)
+            number << "-";
+
+        number << random.nextInt(400);
+
+        if (random.nextBool())
+            number << "." << random.nextInt(1000);
+        if (random.nextInt(4) == 0)
+            number << "%";
+
+        return juce::String::repeatedString(" ", random.nextInt(3)) + number;
+    }
+
+    [[nodiscard]] static juce::String generateColourString(juce::Random& random)
+    {
+        static const juce::StringArray functions{ "rgb", "rgba", "hsl", "hsla", "rgb((", "hsl)" };
+        static const juce::StringArray names{ "red", "Hotpink", "CORNFLOWERBLUE", " green ", "transparentblack", "notacolour" };
+        static constexpr auto hexCharacters = "0123456789abcdefABCDEFxz# ";
+
+        switch (random.nextInt(4))
+        {
+        case 0:
+        {
+            auto text = functions[random.nextInt(functions.size())] + "(";
+            const auto numArguments = random.nextInt(6);
+
+            for (auto argument = 0; argument < numArguments; argument++)
+            {
+                if (argument > 0)
+                    text << ",";
+                if (random.nextInt(8) != 0)
+                    text << generateNumber(random);
+            }
+
+            if (random.nextInt(5) != 0)
+                text << ")";
+
+            return text;
+        }
+        case 1:
+        {
+            juce::String text{ "#" };
+            const auto length = random.nextInt(11);
+
+            for (auto character = 0; character < length; character++)
+                text << juce::String::charToString(hexCharacters[random.nextInt(static_cast<int>(std::strlen(hexCharacters)))]);
+
+            return text;
+        }
+        case 2:
+            return names[random.nextInt(names.size())];
+        default:
+        {
+            juce::String text;
+            const auto length = random.nextInt(12);
+
+            for (auto character = 0; character < length; character++)
+                text << juce::String::charToString(static_cast<juce::juce_wchar>(32 + random.nextInt(95)));
+
+            return text;
+        }
+        }
+    }
+
+    // The implementation parseColour() replaced, which its results must
+    // continue to match.
+    [[nodiscard]] static juce::StringArray getTokensBetweenParentheses(const juce::String& text)
+    {
+        const auto values = text.fromLastOccurrenceOf("(", false, true)
+                                .upToFirstOccurrenceOf(")", false, true);
+        return juce::StringArray::fromTokens(values, ",", "");
+    }
+
+    [[nodiscard]] static juce::Colour parseColourWithStringArrays(const juce::String& colourString)
+    {
+        if (colourString.startsWith("rgb"))
+        {
+            const auto tokens = getTokensBetweenParentheses(colourString);
+            return juce::Colour::fromRGBA(static_cast<juce::uint8>(tokens[0].getIntValue()),
+                                          static_cast<juce::uint8>(tokens[1].getIntValue()),
+                                          static_cast<juce::uint8>(tokens[2].getIntValue()),
+                                          static_cast<juce::uint8>(juce::roundToInt(255.0f * (tokens.size() > 3 ? tokens[3].getFloatValue() : 1.0f))));
+        }
+
+        if (colourString.startsWith("hsl"))
+        {
+            const auto tokens = getTokensBetweenParentheses(colourString);
+            return juce::Colour::fromHSL(tokens[0].getFloatValue() / 360.0f,
+                                         tokens[1].getFloatValue() / 100.0f,
+                                         tokens[2].getFloatValue() / 100.0f,
+                                         tokens.size() > 3 ? tokens[3].getFloatValue() : 1.0f);
+        }
+
+        if (colourString.startsWith("#"))
+        {
+            auto text = colourString.fromLastOccurrenceOf("#", false, true);
+
+            if (text.length() < 3 || text.length() == 5 || text.length() == 7)
+                return juce::Colour{};
+
+            if (text.length() < 5)
+            {
+                for (auto i = text.length() - 1; i >= 0; i--)
+                    text = text.replaceSection(i, 1, text.substring(i, i + 1) + text.substring(i, i + 1));
+            }
+
+            text = text.paddedRight('F', 8);
+            return juce::Colour{
+                static_cast<juce::uint8>(text.substring(0, 2).getHexValue32()),
+                static_cast<juce::uint8>(text.substring(2, 4).getHexValue32()),
+                static_cast<juce::uint8>(text.substring(4, 6).getHexValue32()),
+                static_cast<juce::uint8>(text.substring(6, 8).getHexValue32()),
+            };
+        }
+
+        static const juce::Colour defaultIfNotFound{ 0x12345670 };
+
+        if (auto colour = juce::Colours::findColourForName(colourString, defaultIfNotFound);
+            colour != defaultIfNotFound)
+        {
+            return colour;
+        }
+
+        return juce::Colour::fromString(colourString);
+    }
 };
 
 static ColourParsingUnitTest colourParsingUnitTest;
@@ -0,0 +1,393 @@
+#include "jive_Computed.h"
+
+namespace jive
+{
+    Computation::~Computation()
+    {
+        for (auto& dependency : treeDependencies)
+            dependency.hub->unsubscribe(dependency.propertyName, *this, dependency.scope);
+
+        for (auto& object : objectDependencies)
+            object->removeListener(*this);
+
+        for (auto* dependency : computedDependencies)
+        {
+            auto& dependentsOfDependency = dependency->dependents;
+            dependentsOfDependency.erase(std::remove(std::begin(dependentsOfDependency),
+                                                     std::end(dependentsOfDependency),
+                                                     this),
+                                         std::end(dependentsOfDependency));
+        }
+
+        for (auto* dependent : dependents)
+        {
+            auto& dependencies = dependent->computedDependencies;
+            dependencies.erase(std::remove(std::begin(dependencies), std::end(dependencies), this),
+                               std::end(dependencies));
+            dependent->invalidate();
+        }
+    }
+
+    void Computation::dependOn(const juce::ValueTree& tree,
+                               const juce::Identifier& propertyName,
+                               PropertyHub::Scope scope)
+    {
+        auto hub = PropertyHub::getFor(tree);
+
+        if (hub == nullptr)
+            return;
+
+        const auto alreadyDependent = std::any_of(std::begin(treeDependencies),
+                                                  std::end(treeDependencies),
+                                                  [&hub, &propertyName, scope](const auto& dependency) {
+                                                      return dependency.hub == hub
+                                                          && dependency.propertyName == propertyName
+                                                          && dependency.scope == scope;
+                                                  });
+
+        if (alreadyDependent)
+            return;
+
+        hub->subscribe(propertyName, *this, scope);
+        treeDependencies.push_back({ std::move(hub), propertyName, scope });
+    }
+
+    void Computation::dependOn(const Object::ReferenceCountedPointer& object)
+    {
+        if (object == nullptr
+            || std::find(std::begin(objectDependencies), std::end(objectDependencies), object) != std::end(objectDependencies))
+        {
+            return;
+        }
+
+        objectDependencies.push_back(object);
+        object->addListener(*this);
+    }
+
+    void Computation::dependOn(Computation& computation)
+    {
+        jassert(&computation != this);
+
+        if (std::find(std::begin(computedDependencies), std::end(computedDependencies), &computation)
+            != std::end(computedDependencies))
+        {
+            return;
+        }
+
+        computedDependencies.push_back(&computation);
+        computation.dependents.push_back(this);
+    }
+
+    void Computation::invalidate()
+    {
+        if (!valid)
+            return;
+
+        valid = false;
+
+        // The dependents might be deleted as a result of being invalidated,
+        // so iterate over a copy.
+        const auto dependentsToInvalidate = dependents;
+
+        for (auto* dependent : dependentsToInvalidate)
+        {
+            if (std::find(std::begin(dependents), std::end(dependents), dependent) != std::end(dependents))
+                dependent->invalidate();
+        }
+
+        if (onInvalidate != nullptr)
+            onInvalidate();
+    }
+
+    bool Computation::isValid() const noexcept
+    {
+        return valid;
+    }
+
+    int Computation::getNumDependencies() const noexcept
+    {
+        return static_cast<int>(std::size(treeDependencies)
+                                + std::size(objectDependencies)
+                                + std::size(computedDependencies));
+    }
+
+    bool Computation::validate() noexcept
+    {
+        const auto wasValid = std::exchange(valid, true);
+        return !wasValid;
+    }
+
+    void Computation::subscribedPropertyChanged(juce::ValueTree&, const juce::Identifier&)
+    {
+        invalidate();
+    }
+
+    void Computation::propertyChanged(Object&, const juce::Identifier&)
+    {
+        invalidate();
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+    #include "jive_Property.h"
+
+class ComputedUnitTest : public juce::UnitTest
+{
+public:
+    ComputedUnitTest()
+        : juce::UnitTest{ "jive::Computed", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testMemoisation();
+        testTreeDependencies();
+        testObjectDependencies();
+        testChainedComputations();
+        testArguments();
+        testPropertyValues();
+    }
+
+private:
+    void testMemoisation()
+    {
+        beginTest("memoisation");
+
+        juce::ValueTree tree{
+            "Tree",
+            {
+                { "width", 10 },
+            },
+        };
+        jive::Property<int> width{ tree, "width" };
+        auto numEvaluations = 0;
+        jive::Computed<int> doubleWidth{
+            [&] {
+                numEvaluations++;
+                return width.get() * 2;
+            },
+        };
+        doubleWidth.dependOn(tree, width.id);
+        expectEquals(numEvaluations, 0);
+        expectEquals(doubleWidth.get(), 20);
+        expectEquals(doubleWidth.get(), 20);
+        expectEquals(numEvaluations, 1);
+        expectEquals(doubleWidth.getNumDependencies(), 1);
+
+        tree.setProperty("width", 15, nullptr);
+        expect(!doubleWidth.isValid());
+        expectEquals(numEvaluations, 1);
+        expectEquals(doubleWidth.get(), 30);
+        expectEquals(numEvaluations, 2);
+
+        tree.setProperty("height", 15, nullptr);
+        expect(doubleWidth.isValid());
+    }
+
+    void testTreeDependencies()
+    {
+        beginTest("tree dependencies");
+
+        juce::ValueTree tree{
+            "Tree",
+            {
+                { "font-size", 12 },
+            },
+            {
+                juce::ValueTree{ "Child" },
+            },
+        };
+        auto child = tree.getChild(0);
+        jive::Property<float, jive::Inheritance::inheritFromAncestors> fontSize{ child, "font-size" };
+        jive::Computed<float> inheritedFontSize{
+            [&] {
+                return fontSize.get();
+            },
+        };
+        inheritedFontSize.dependOn(child, fontSize.id, jive::PropertyHub::Scope::inherited);
+        inheritedFontSize.dependOn(child, fontSize.id, jive::PropertyHub::Scope::inherited);
+        expectEquals(inheritedFontSize.getNumDependencies(), 1);
+        expectEquals(inheritedFontSize.get(), 12.0f);
+
+        tree.setProperty("font-size", 14, nullptr);
+        expect(!inheritedFontSize.isValid());
+        expectEquals(inheritedFontSize.get(), 14.0f);
+
+        child.setProperty("font-size", 16, nullptr);
+        expectEquals(inheritedFontSize.get(), 16.0f);
+
+        tree.setProperty("font-size", 18, nullptr);
+        expect(inheritedFontSize.isValid());
+    }
+
+    void testObjectDependencies()
+    {
+        beginTest("object dependencies");
+
+        jive::Object::ReferenceCountedPointer object = new jive::Object{
+            { "opacity", 0.5 },
+        };
+        jive::Property<double> opacity{ object, "opacity" };
+        jive::Computed<double> percentage{
+            [&] {
+                return opacity.get() * 100.0;
+            },
+        };
+        percentage.dependOn(object);
+        expectEquals(percentage.get(), 50.0);
+
+        object->setProperty("opacity", 0.25);
+        expect(!percentage.isValid());
+        expectEquals(percentage.get(), 25.0);
+    }
+
+    void testChainedComputations()
+    {
+        beginTest("chained computations");
+
+        juce::ValueTree tree{
+            "Tree",
+            {
+                { "width", 10 },
+                { "height", 20 },
+            },
+        };
+        jive::Property<int> width{ tree, "width" };
+        jive::Property<int> height{ tree, "height" };
+        juce::StringArray evaluations;
+        jive::Computed<int> area{
+            [&] {
+                evaluations.add("area");
+                return width.get() * height.get();
+            },
+        };
+        area.dependOn(tree, width.id);
+        area.dependOn(tree, height.id);
+        jive::Computed<int> perimeter{
+            [&] {
+                evaluations.add("perimeter");
+                return 2 * (width.get() + height.get());
+            },
+        };
+        perimeter.dependOn(tree, width.id);
+        perimeter.dependOn(tree, height.id);
+        jive::Computed<juce::String> summary{
+            [&] {
+                evaluations.add("summary");
+                return juce::String{ area.get() } + "/" + juce::String{ perimeter.get() };
+            },
+        };
+        summary.dependOn(area);
+        summary.dependOn(perimeter);
+        auto numInvalidations = 0;
+        summary.onInvalidate = [&numInvalidations] {
+            numInvalidations++;
+        };
+        expectEquals(summary.get(), juce::String{ "200/60" });
+        expectEquals(evaluations.joinIntoString(","), juce::String{ "summary,area,perimeter" });
+
+        evaluations.clear();
+        tree.setProperty("width", 5, nullptr);
+        tree.setProperty("height", 10, nullptr);
+        expectEquals(numInvalidations, 1);
+        expect(evaluations.isEmpty());
+        expectEquals(summary.get(), juce::String{ "50/30" });
+        expectEquals(evaluations.joinIntoString(","), juce::String{ "summary,area,perimeter" });
+
+        evaluations.clear();
+        area.invalidate();
+        expect(!summary.isValid());
+        expect(perimeter.isValid());
+        expectEquals(summary.get(), juce::String{ "50/30" });
+        expectEquals(evaluations.joinIntoString(","), juce::String{ "summary,area" });
+
+        {
+            jive::Computed<int> doublePerimeter{
+                [&] {
+                    return perimeter.get() * 2;
+                },
+            };
+            doublePerimeter.dependOn(perimeter);
+            expectEquals(doublePerimeter.get(), 60);
+        }
+
+        tree.setProperty("width", 6, nullptr);
+        expectEquals(summary.get(), juce::String{ "60/32" });
+    }
+
+    void testArguments()
+    {
+        beginTest("arguments");
+
+        auto scale = 2;
+        auto numEvaluations = 0;
+        jive::Computed<int, int> scaled{
+            [&](int value) {
+                numEvaluations++;
+                return value * scale;
+            },
+            2,
+        };
+        expectEquals(scaled.get(1), 2);
+        expectEquals(scaled.get(2), 4);
+        expectEquals(scaled.get(1), 2);
+        expectEquals(numEvaluations, 2);
+
+        expectEquals(scaled.get(3), 6);
+        expectEquals(numEvaluations, 3);
+        expectEquals(scaled.get(3), 6);
+        expectEquals(numEvaluations, 3);
+
+        scale = 3;
+        scaled.invalidate();
+        expectEquals(scaled.get(3), 9);
+        expectEquals(numEvaluations, 4);
+    }
+
+    void testPropertyValues()
+    {
+        beginTest("property values");
+
+        juce::ValueTree tree{
+            "Tree",
+            {
+                { "text", "Hello" },
+            },
+        };
+        jive::Property<juce::String> text{ tree, "text" };
+        auto numEvaluations = 0;
+        auto length = std::make_unique<jive::Computed<int>>(
+            [&] {
+                numEvaluations++;
+                return text.get().length();
+            });
+        length->dependOn(tree, text.id);
+        jive::Property<int> textLength{ tree, "text-length" };
+        tree.setProperty(textLength.id, length->toVar(), nullptr);
+        expectEquals(textLength.get(), 5);
+        expectEquals(textLength.get(), 5);
+        expectEquals(numEvaluations, 1);
+
+        tree.setProperty("text", "Goodbye", nullptr);
+        expectEquals(textLength.get(), 7);
+        expectEquals(numEvaluations, 2);
+
+        jive::Computed<float, float> padded{
+            [](float width) {
+                return width + 10.0f;
+            },
+        };
+        const auto paddedVar = padded.toVar();
+        juce::var arguments[] = { 5.0f };
+        expectEquals(static_cast<float>(paddedVar.getNativeFunction()({ paddedVar, arguments, 1 })), 15.0f);
+        expectEquals(static_cast<float>(paddedVar.getNativeFunction()({ paddedVar, nullptr, 0 })), 10.0f);
+
+        const auto lengthVar = tree[textLength.id];
+        length = nullptr;
+        expect(lengthVar.getNativeFunction()({ lengthVar, nullptr, 0 }).isVoid());
+    }
+};
+
+static ComputedUnitTest computedUnitTest;
+#endif
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "jive_Object.h"
+#include "jive_PropertyHub.h"
+#include "variant-converters/jive_VariantConvertion.h"
+
+#include <juce_data_structures/juce_data_structures.h>
+
+namespace jive
+{
+    /** Keeps track of the values a derived value depends on, so it only has
+        to be evaluated again once one of them changes.
+
+        Dependencies are declared up front with dependOn(), rather than being
+        recorded as they're read, so reading a Property never costs anything
+        extra.
+
+        Invalidation is pushed eagerly through everything that depends on a
+        changed value, but nothing is re-evaluated until it's next read. As
+        each computation reads its own dependencies while it's evaluated,
+        values are always recomputed in dependency order, and a value that's
+        no longer read is never recomputed at all.
+    */
+    class Computation
+        : private PropertyHub::Subscriber
+        , private Object::Listener
+    {
+    public:
+        ~Computation() override;
+
+        /** Invalidates this computation whenever the given property of the
+            given tree changes, within the given scope.
+        */
+        void dependOn(const juce::ValueTree& tree,
+                      const juce::Identifier& propertyName,
+                      PropertyHub::Scope scope = PropertyHub::Scope::node);
+
+        /** Invalidates this computation whenever any property of the given
+            object changes.
+        */
+        void dependOn(const Object::ReferenceCountedPointer& object);
+
+        /** Invalidates this computation whenever the given one is
+            invalidated.
+        */
+        void dependOn(Computation& computation);
+
+        /** Marks the value as stale, along with anything that depends on it,
+            and calls onInvalidate. Does nothing if the value is already stale.
+        */
+        void invalidate();
+
+        [[nodiscard]] bool isValid() const noexcept;
+        [[nodiscard]] int getNumDependencies() const noexcept;
+
+        std::function<void()> onInvalidate = nullptr;
+
+    protected:
+        Computation() = default;
+
+        /** Marks the value as up to date, returning true if it was stale and
+            any previous results need discarding.
+        */
+        [[nodiscard]] bool validate() noexcept;
+
+    private:
+        struct TreeDependency
+        {
+            PropertyHub::ReferenceCountedPointer hub;
+            juce::Identifier propertyName;
+            PropertyHub::Scope scope;
+        };
+
+        void subscribedPropertyChanged(juce::ValueTree& treeWhosePropertyChanged,
+                                       const juce::Identifier& propertyName) final;
+        void propertyChanged(Object& object, const juce::Identifier& propertyName) final;
+
+        std::vector<TreeDependency> treeDependencies;
+        std::vector<Object::ReferenceCountedPointer> objectDependencies;
+        std::vector<Computation*> computedDependencies;
+        std::vector<Computation*> dependents;
+        bool valid = true;
+
+        JUCE_DECLARE_WEAK_REFERENCEABLE(Computation)
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Computation)
+    };
+
+    /** A value derived from Properties, and from other Computed values, that's
+        only recomputed once one of its dependencies has changed.
+
+        The value can take arguments, in which case the results for the most
+        recently used arguments are kept, and all of them are discarded
+        together when the value is invalidated.
+    */
+    template <typename ValueType, typename... Arguments>
+    class Computed : public Computation
+    {
+    public:
+        using Function = std::function<ValueType(Arguments...)>;
+
+        explicit Computed(Function computeValue, std::size_t maxNumResultsToKeep = 16)
+            : compute{ std::move(computeValue) }
+            , maxNumResults{ juce::jmax<std::size_t>(1, maxNumResultsToKeep) }
+        {
+            jassert(compute != nullptr);
+        }
+
+        [[nodiscard]] ValueType get(Arguments... arguments)
+        {
+            if (validate())
+                results.clear();
+
+            auto key = std::make_tuple(arguments...);
+
+            if (const auto result = std::find_if(std::begin(results),
+                                                 std::end(results),
+                                                 [&key](const auto& entry) {
+                                                     return entry.first == key;
+                                                 });
+                result != std::end(results))
+            {
+                return result->second;
+            }
+
+            if (std::size(results) >= maxNumResults)
+                results.clear();
+
+            auto value = compute(arguments...);
+            results.emplace_back(std::move(key), value);
+            return value;
+        }
+
+        /** Returns a functional var that evaluates to this value, converting
+            its arguments to this value's argument types. Any missing
+            arguments are converted from a void var. Once this object has been
+            deleted, the var evaluates to a void var.
+        */
+        [[nodiscard]] juce::var toVar()
+        {
+            return juce::var::NativeFunction{
+                [safeThis = juce::WeakReference<Computation>{ this }](const juce::var::NativeFunctionArgs& args) -> juce::var {
+                    if (auto* computed = static_cast<Computed*>(safeThis.get()))
+                        return computed->invoke(args, std::index_sequence_for<Arguments...>{});
+
+                    return {};
+                },
+            };
+        }
+
+    private:
+        template <std::size_t... indices>
+        [[nodiscard]] juce::var invoke(const juce::var::NativeFunctionArgs& args,
+                                       std::index_sequence<indices...>)
+        {
+            juce::ignoreUnused(args);
+
+            return jive::toVar(get(fromVar<Arguments>(static_cast<int>(indices) < args.numArguments
+                                                          ? args.arguments[indices]
+                                                          : juce::var{})...));
+        }
+
+        Function compute;
+        std::size_t maxNumResults;
+        std::vector<std::pair<std::tuple<Arguments...>, ValueType>> results;
+    };
+} // namespace jive
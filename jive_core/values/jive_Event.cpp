@@ -1,5 +1,200 @@
 #include "jive_Event.h"
 
+namespace jive
+{
+    Event::Channel::Channel() = default;
+
+    Event::Channel::Channel(const Object& stateToAdopt)
+        : Object{ stateToAdopt }
+        , triggerCount{ static_cast<int>(stateToAdopt[ids::count]) }
+        , timeLastTriggered{ static_cast<juce::int64>(stateToAdopt[ids::time]) }
+    {
+    }
+
+    int Event::Channel::getTriggerCount() const noexcept
+    {
+        return triggerCount;
+    }
+
+    juce::Time Event::Channel::getTimeLastTriggered() const noexcept
+    {
+        return juce::Time{ timeLastTriggered };
+    }
+
+    int Event::Channel::getNumSubscribers() const noexcept
+    {
+        return static_cast<int>(std::count_if(std::begin(subscribers),
+                                              std::end(subscribers),
+                                              [](const auto* subscriber) {
+                                                  return subscriber != nullptr;
+                                              }));
+    }
+
+    void Event::Channel::publishPendingState()
+    {
+        handleUpdateNowIfNeeded();
+    }
+
+    void Event::Channel::trigger(const Event* eventToSkip)
+    {
+        triggerCount++;
+        timeLastTriggered = juce::Time::currentTimeMillis();
+        triggerAsyncUpdate();
+
+        // A callback might destroy the last Event referring to this channel.
+        const ReferenceCountedPointer keepAlive{ this };
+
+        // Events subscribed by a callback aren't called until the next trigger,
+        // and those unsubscribed by one leave an empty slot until the end.
+        dispatchDepth++;
+        const auto numSubscribers = std::size(subscribers);
+
+        for (std::size_t index = 0; index < numSubscribers; index++)
+        {
+            auto* subscriber = subscribers[index];
+
+            if (subscriber != nullptr
+                && subscriber != eventToSkip
+                && subscriber->onTrigger != nullptr)
+            {
+                subscriber->onTrigger();
+            }
+        }
+
+        dispatchDepth--;
+
+        if (dispatchDepth == 0 && hasEmptySlots)
+            removeUnsubscribedSlots();
+    }
+
+    void Event::Channel::subscribe(Event& event)
+    {
+        event.subscriberIndex = std::size(subscribers);
+        subscribers.push_back(&event);
+    }
+
+    void Event::Channel::unsubscribe(Event& event)
+    {
+        jassert(subscribers[event.subscriberIndex] == &event);
+
+        if (dispatchDepth > 0)
+        {
+            subscribers[event.subscriberIndex] = nullptr;
+            hasEmptySlots = true;
+            return;
+        }
+
+        auto* lastSubscriber = subscribers.back();
+        lastSubscriber->subscriberIndex = event.subscriberIndex;
+        subscribers[event.subscriberIndex] = lastSubscriber;
+        subscribers.pop_back();
+    }
+
+    void Event::Channel::removeUnsubscribedSlots()
+    {
+        subscribers.erase(std::remove(std::begin(subscribers),
+                                      std::end(subscribers),
+                                      nullptr),
+                          std::end(subscribers));
+
+        for (std::size_t index = 0; index < std::size(subscribers); index++)
+            subscribers[index]->subscriberIndex = index;
+
+        hasEmptySlots = false;
+    }
+
+    void Event::Channel::handleAsyncUpdate()
+    {
+        setProperty(ids::count, triggerCount);
+        setProperty(ids::time, timeLastTriggered);
+    }
+
+    Event::Event(juce::ValueTree sourceState, const juce::Identifier& eventID)
+        : id{ eventID }
+        , event{ sourceState, eventID }
+    {
+        event.onValueChange = [this] {
+            attachToChannel();
+        };
+        attachToChannel();
+    }
+
+    Event::Event(const Event& other)
+        : id{ other.id }
+        , event{ other.event }
+    {
+        event.onValueChange = [this] {
+            attachToChannel();
+        };
+        attachToChannel();
+    }
+
+    Event::Event(Event&& other)
+        : Event{ static_cast<const Event&>(other) }
+    {
+    }
+
+    Event& Event::operator=(const Event& other)
+    {
+        event = other.event.get();
+        attachToChannel();
+        return *this;
+    }
+
+    Event::~Event()
+    {
+        detachFromChannel();
+    }
+
+    int Event::getAssumedTriggerCount() const
+    {
+        return channel->getTriggerCount();
+    }
+
+    juce::Time Event::getTimeLastTriggered() const
+    {
+        return channel->getTimeLastTriggered();
+    }
+
+    void Event::trigger()
+    {
+        channel->trigger(nullptr);
+    }
+
+    void Event::triggerWithoutSelfCallback()
+    {
+        channel->trigger(this);
+    }
+
+    void Event::attachToChannel()
+    {
+        const auto object = event.get();
+        Channel::ReferenceCountedPointer newChannel = dynamic_cast<Channel*>(object.get());
+        const auto needsStoring = newChannel == nullptr;
+
+        if (needsStoring)
+            newChannel = object == nullptr ? new Channel{} : new Channel{ *object };
+
+        if (newChannel != channel)
+        {
+            detachFromChannel();
+            channel = newChannel;
+            channel->subscribe(*this);
+        }
+
+        if (needsStoring)
+            event = Object::ReferenceCountedPointer{ channel.get() };
+    }
+
+    void Event::detachFromChannel()
+    {
+        if (channel != nullptr)
+            channel->unsubscribe(*this);
+
+        channel = nullptr;
+    }
+} // namespace jive
+
 #if JIVE_UNIT_TESTS
     #include <jive_core/logging/jive_StringStreams.h>
 
@@ -17,6 +212,9 @@ public:
         testObserving();
         testTiming();
         testCopying();
+        testUnsubscribing();
+        testSubscribingDuringTrigger();
+        testPublishing();
     }
 
 private:
@@ -112,6 +310,134 @@ private:
         clonedEvent.trigger();
         expect(wasTriggered);
     }
+
+    void testUnsubscribing()
+    {
+        beginTest("unsubscribing");
+
+        juce::ValueTree state{ "State" };
+        jive::Event event{ state, "event" };
+        auto* channel = getChannel(state, "event");
+        expectEquals(channel->getNumSubscribers(), 1);
+
+        {
+            std::vector<std::unique_ptr<jive::Event>> events;
+
+            for (auto i = 0; i < 100; i++)
+                events.push_back(std::make_unique<jive::Event>(state, "event"));
+
+            expectEquals(channel->getNumSubscribers(), 101);
+
+            for (auto i = 0; i < 100; i += 2)
+                events[static_cast<std::size_t>(i)] = nullptr;
+
+            expectEquals(channel->getNumSubscribers(), 51);
+
+            auto numCallbacks = 0;
+
+            for (auto& remainingEvent : events)
+            {
+                if (remainingEvent != nullptr)
+                {
+                    remainingEvent->onTrigger = [&numCallbacks] {
+                        numCallbacks++;
+                    };
+                }
+            }
+
+            event.trigger();
+            expectEquals(numCallbacks, 50);
+        }
+
+        expectEquals(channel->getNumSubscribers(), 1);
+
+        auto otherEvent = std::make_unique<jive::Event>(state, "event");
+        auto otherWasTriggered = false;
+        otherEvent->onTrigger = [&otherWasTriggered] {
+            otherWasTriggered = true;
+        };
+        event.onTrigger = [&otherEvent] {
+            otherEvent = nullptr;
+        };
+        event.trigger();
+        expect(!otherWasTriggered);
+        expectEquals(channel->getNumSubscribers(), 1);
+    }
+
+    void testSubscribingDuringTrigger()
+    {
+        beginTest("subscribing during trigger");
+
+        juce::ValueTree state{ "State" };
+        jive::Event event{ state, "event" };
+        std::unique_ptr<jive::Event> lateEvent;
+        auto numLateCallbacks = 0;
+
+        event.onTrigger = [&] {
+            if (lateEvent != nullptr)
+                return;
+
+            lateEvent = std::make_unique<jive::Event>(state, "event");
+            lateEvent->onTrigger = [&numLateCallbacks] {
+                numLateCallbacks++;
+            };
+        };
+
+        event.trigger();
+        expectEquals(numLateCallbacks, 0);
+
+        event.trigger();
+        expectEquals(numLateCallbacks, 1);
+    }
+
+    void testPublishing()
+    {
+        beginTest("publishing");
+
+        struct Listener : public jive::Object::Listener
+        {
+            void propertyChanged(jive::Object&, const juce::Identifier&) final
+            {
+                numChanges++;
+            }
+
+            int numChanges = 0;
+        };
+
+        juce::ValueTree state{
+            "State",
+            {
+                { "event", new jive::Object{ { "count", 5 } } },
+            },
+        };
+        jive::Event event{ state, "event" };
+        expectEquals(event.getAssumedTriggerCount(), 5);
+
+        auto* channel = getChannel(state, "event");
+        expect(channel != nullptr);
+
+        Listener listener;
+        channel->addListener(listener);
+
+        for (auto i = 0; i < 100; i++)
+            event.trigger();
+
+        expectEquals(listener.numChanges, 0);
+        expectEquals(event.getAssumedTriggerCount(), 105);
+
+        channel->publishPendingState();
+        expectEquals(listener.numChanges, 2);
+        expectEquals(static_cast<int>((*channel)["count"]), 105);
+        expect(juce::Time{ static_cast<juce::int64>((*channel)["time"]) } == event.getTimeLastTriggered());
+
+        channel->removeListener(listener);
+    }
+
+    [[nodiscard]] static jive::Event::Channel* getChannel(const juce::ValueTree& state,
+                                                          const juce::Identifier& id)
+    {
+        return dynamic_cast<jive::Event::Channel*>(state[id].getDynamicObject());
+    }
 };
 
 static EventUnitTest eventUnitTest;
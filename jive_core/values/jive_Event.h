@@ -2,108 +2,83 @@
 
 #include "jive_Property.h"
 
+#include <juce_events/juce_events.h>
+
 namespace jive
 {
-    class Event : protected juce::ValueTree::Listener
+    class Event
     {
     public:
-        Event() = delete;
-
-        Event(juce::ValueTree sourceState, const juce::Identifier& eventID)
-            : id{ eventID }
-            , event{ sourceState, eventID }
+        /** The object stored in an event's ValueTree property, shared by every
+            Event that refers to that property.
+
+            Triggering calls the subscribed Events directly, so the trigger
+            count and time are only written to the object's "count" and "time"
+            properties once the message thread gets round to it, no matter how
+            many times the event was triggered in the meantime.
+        */
+        class Channel
+            : public Object
+            , private juce::AsyncUpdater
         {
-            if (!event.exists())
-                event = new Object{};
+        public:
+            using ReferenceCountedPointer = juce::ReferenceCountedObjectPtr<Channel>;
 
-            auto callbacks = event.get()->getProperty("callbacks");
+            Channel();
+            explicit Channel(const Object& stateToAdopt);
 
-            callbacks.append(juce::var{
-                [weakThis = juce::WeakReference{ this }](const juce::var::NativeFunctionArgs&) {
-                    if (weakThis != nullptr && weakThis->onTrigger != nullptr)
-                        weakThis->onTrigger();
+            [[nodiscard]] int getTriggerCount() const noexcept;
+            [[nodiscard]] juce::Time getTimeLastTriggered() const noexcept;
+            [[nodiscard]] int getNumSubscribers() const noexcept;
 
-                    return juce::var{};
-                },
-            });
+            /** Writes any pending trigger count and time to the object's
+                properties straight away.
+            */
+            void publishPendingState();
 
-            event.get()->setProperty("callbacks", callbacks);
-        }
+        private:
+            friend class Event;
 
-        Event(const Event& other)
-            : event{ other.event }
-        {
-        }
+            void trigger(const Event* eventToSkip);
+            void subscribe(Event& event);
+            void unsubscribe(Event& event);
+            void removeUnsubscribedSlots();
+            void handleAsyncUpdate() final;
 
-        Event(Event&& other)
-            : event{ std::move(other.event) }
-        {
-        }
+            std::vector<Event*> subscribers;
+            int triggerCount = 0;
+            juce::int64 timeLastTriggered = 0;
+            int dispatchDepth = 0;
+            bool hasEmptySlots = false;
 
-        Event& operator=(const Event& other)
-        {
-            event = other.event.get();
-            return *this;
-        }
+            JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Channel)
+        };
 
+        Event() = delete;
+        Event(juce::ValueTree sourceState, const juce::Identifier& eventID);
+        Event(const Event& other);
+        Event(Event&& other);
+        Event& operator=(const Event& other);
         Event& operator=(Event&& other) = delete;
-        ~Event() = default;
+        ~Event();
 
-        int getAssumedTriggerCount() const
-        {
-            if (!event.get()->hasProperty("count"))
-                return 0;
+        int getAssumedTriggerCount() const;
+        juce::Time getTimeLastTriggered() const;
 
-            return static_cast<int>(event.get()->getProperty("count"));
-        }
-
-        juce::Time getTimeLastTriggered() const
-        {
-            if (!event.get()->hasProperty("time"))
-                return juce::Time{};
-
-            return juce::Time{
-                static_cast<juce::int64>(event.get()->getProperty("time")),
-            };
-        }
-
-        void trigger()
-        {
-            event
-                .get()
-                ->setProperty("count", getAssumedTriggerCount() + 1);
-            event
-                .get()
-                ->setProperty("time", juce::Time::currentTimeMillis());
-
-            for (auto& callback : *event.get()->getProperty("callbacks").getArray())
-            {
-                callback.getNativeFunction()(juce::var::NativeFunctionArgs{
-                    callback,
-                    nullptr,
-                    0,
-                });
-            }
-        }
-
-        void triggerWithoutSelfCallback()
-        {
-            const auto callback = onTrigger;
-            onTrigger = nullptr;
-
-            juce::WeakReference weakThis{ this };
-            trigger();
-
-            if (weakThis != nullptr)
-                weakThis->onTrigger = callback;
-        }
+        void trigger();
+        void triggerWithoutSelfCallback();
 
         const juce::Identifier id;
 
         std::function<void()> onTrigger = nullptr;
 
     private:
+        void attachToChannel();
+        void detachFromChannel();
+
         Property<Object::ReferenceCountedPointer> event;
+        Channel::ReferenceCountedPointer channel;
+        std::size_t subscriberIndex = 0;
 
         JUCE_DECLARE_WEAK_REFERENCEABLE(Event)
     };
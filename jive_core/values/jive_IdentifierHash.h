@@ -0,0 +1,19 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+namespace std
+{
+    template <>
+    class hash<juce::Identifier>
+    {
+    public:
+        std::size_t operator()(const juce::Identifier& id) const
+        {
+            // Identifiers with the same name always share the same pooled
+            // string, so its address is enough to tell them apart without
+            // walking the characters.
+            return std::hash<const void*>{}(id.getCharPointer().getAddress());
+        }
+    };
+} // namespace std
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+namespace jive
+{
+    /** The names of the properties JIVE itself reads and writes.
+
+        Constructing a juce::Identifier from a string has to look the string up
+        in JUCE's global string pool, so these are created once up-front
+        rather than every time a Property or listener needs one.
+    */
+    namespace ids
+    {
+        inline const juce::Identifier alignContent{ "align-content" };
+        inline const juce::Identifier alignItems{ "align-items" };
+        inline const juce::Identifier alignSelf{ "align-self" };
+        inline const juce::Identifier background{ "background" };
+        inline const juce::Identifier border{ "border" };
+        inline const juce::Identifier borderRadius{ "border-radius" };
+        inline const juce::Identifier borderWidth{ "border-width" };
+        inline const juce::Identifier boxModelCallbackLock{ "box-model-callback-lock" };
+        inline const juce::Identifier centreX{ "centre-x" };
+        inline const juce::Identifier centreY{ "centre-y" };
+        inline const juce::Identifier className{ "class" };
+        inline const juce::Identifier componentHeight{ "component-height" };
+        inline const juce::Identifier componentWidth{ "component-width" };
+        inline const juce::Identifier cornerResizer{ "corner-resizer" };
+        inline const juce::Identifier count{ "count" };
+        inline const juce::Identifier direction{ "direction" };
+        inline const juce::Identifier display{ "display" };
+        inline const juce::Identifier draggable{ "draggable" };
+        inline const juce::Identifier editable{ "editable" };
+        inline const juce::Identifier enabled{ "enabled" };
+        inline const juce::Identifier end{ "end" };
+        inline const juce::Identifier fill{ "fill" };
+        inline const juce::Identifier flexBasis{ "flex-basis" };
+        inline const juce::Identifier flexDirection{ "flex-direction" };
+        inline const juce::Identifier flexGrow{ "flex-grow" };
+        inline const juce::Identifier flexShrink{ "flex-shrink" };
+        inline const juce::Identifier flexWrap{ "flex-wrap" };
+        inline const juce::Identifier focusable{ "focusable" };
+        inline const juce::Identifier fontFamily{ "font-family" };
+        inline const juce::Identifier fontSize{ "font-size" };
+        inline const juce::Identifier fontStretch{ "font-stretch" };
+        inline const juce::Identifier fontStyle{ "font-style" };
+        inline const juce::Identifier fontWeight{ "font-weight" };
+        inline const juce::Identifier foreground{ "foreground" };
+        inline const juce::Identifier fullScreen{ "full-screen" };
+        inline const juce::Identifier gap{ "gap" };
+        inline const juce::Identifier gradient{ "gradient" };
+        inline const juce::Identifier gridArea{ "grid-area" };
+        inline const juce::Identifier gridAutoColumns{ "grid-auto-columns" };
+        inline const juce::Identifier gridAutoFlow{ "grid-auto-flow" };
+        inline const juce::Identifier gridAutoRows{ "grid-auto-rows" };
+        inline const juce::Identifier gridColumn{ "grid-column" };
+        inline const juce::Identifier gridRow{ "grid-row" };
+        inline const juce::Identifier gridTemplateAreas{ "grid-template-areas" };
+        inline const juce::Identifier gridTemplateColumns{ "grid-template-columns" };
+        inline const juce::Identifier gridTemplateRows{ "grid-template-rows" };
+        inline const juce::Identifier height{ "height" };
+        inline const juce::Identifier id{ "id" };
+        inline const juce::Identifier idealHeight{ "ideal-height" };
+        inline const juce::Identifier idealSize{ "ideal-size" };
+        inline const juce::Identifier idealWidth{ "ideal-width" };
+        inline const juce::Identifier interval{ "interval" };
+        inline const juce::Identifier justification{ "justification" };
+        inline const juce::Identifier justifyContent{ "justify-content" };
+        inline const juce::Identifier justifyItems{ "justify-items" };
+        inline const juce::Identifier justifySelf{ "justify-self" };
+        inline const juce::Identifier keyboard{ "keyboard" };
+        inline const juce::Identifier layoutChildren{ "layout-children" };
+        inline const juce::Identifier letterSpacing{ "letter-spacing" };
+        inline const juce::Identifier lineSpacing{ "line-spacing" };
+        inline const juce::Identifier makeView{ "make-view" };
+        inline const juce::Identifier margin{ "margin" };
+        inline const juce::Identifier max{ "max" };
+        inline const juce::Identifier maxHeight{ "max-height" };
+        inline const juce::Identifier maxWidth{ "max-width" };
+        inline const juce::Identifier mid{ "mid" };
+        inline const juce::Identifier min{ "min" };
+        inline const juce::Identifier minHeight{ "min-height" };
+        inline const juce::Identifier minimised{ "minimised" };
+        inline const juce::Identifier minWidth{ "min-width" };
+        inline const juce::Identifier mouse{ "mouse" };
+        inline const juce::Identifier name{ "name" };
+        inline const juce::Identifier native{ "native" };
+        inline const juce::Identifier onChange{ "on-change" };
+        inline const juce::Identifier onClick{ "on-click" };
+        inline const juce::Identifier opacity{ "opacity" };
+        inline const juce::Identifier order{ "order" };
+        inline const juce::Identifier orientation{ "orientation" };
+        inline const juce::Identifier padding{ "padding" };
+        inline const juce::Identifier placement{ "placement" };
+        inline const juce::Identifier radioGroup{ "radio-group" };
+        inline const juce::Identifier resizable{ "resizable" };
+        inline const juce::Identifier selected{ "selected" };
+        inline const juce::Identifier sensitivity{ "sensitivity" };
+        inline const juce::Identifier shadow{ "shadow" };
+        inline const juce::Identifier snapToMouse{ "snap-to-mouse" };
+        inline const juce::Identifier source{ "source" };
+        inline const juce::Identifier start{ "start" };
+        inline const juce::Identifier stops{ "stops" };
+        inline const juce::Identifier style{ "style" };
+        inline const juce::Identifier styleSheet{ "style-sheet" };
+        inline const juce::Identifier text{ "text" };
+        inline const juce::Identifier textDecoration{ "text-decoration" };
+        inline const juce::Identifier time{ "time" };
+        inline const juce::Identifier titleBarButtons{ "title-bar-buttons" };
+        inline const juce::Identifier titleBarHeight{ "title-bar-height" };
+        inline const juce::Identifier toggleable{ "toggleable" };
+        inline const juce::Identifier toggled{ "toggled" };
+        inline const juce::Identifier toggleOnClick{ "toggle-on-click" };
+        inline const juce::Identifier tooltip{ "tooltip" };
+        inline const juce::Identifier transition{ "transition" };
+        inline const juce::Identifier triggerEvent{ "trigger-event" };
+        inline const juce::Identifier url{ "url" };
+        inline const juce::Identifier value{ "value" };
+        inline const juce::Identifier velocityMode{ "velocity-mode" };
+        inline const juce::Identifier velocityOffset{ "velocity-offset" };
+        inline const juce::Identifier velocitySensitivity{ "velocity-sensitivity" };
+        inline const juce::Identifier velocityThreshold{ "velocity-threshold" };
+        inline const juce::Identifier viewObject{ "view-object" };
+        inline const juce::Identifier width{ "width" };
+        inline const juce::Identifier wordWrap{ "word-wrap" };
+        inline const juce::Identifier x{ "x" };
+        inline const juce::Identifier y{ "y" };
+    } // namespace ids
+} // namespace jive
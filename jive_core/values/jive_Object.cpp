@@ -1,5 +1,8 @@
 #include "jive_Object.h"
 
+#include "jive_Identifiers.h"
+#include "jive_PropertyHub.h"
+
 #include <jive_core/logging/jive_StringStreams.h>
 
 namespace jive
@@ -10,45 +13,59 @@ namespace jive
         explicit InternalListener(Object& obj)
             : object{ obj }
         {
-            for (const auto& nested : findNestedObjects())
-                nested->addListener(*this);
+            for (const auto& child : object.children)
+                attach(*child.object);
+        }
 
-            object.addListener(*this);
+        ~InternalListener() override
+        {
+            for (const auto& child : object.children)
+                detach(*child.object);
         }
 
-        void propertyChanged(Object& objectThatChanged,
-                             const juce::Identifier& propertyName) final
+        void attach(Object& child)
         {
-            if (&objectThatChanged == &object)
-            {
-                for (const auto& nested : findNestedObjects())
-                    nested->addListener(*this);
-            }
-            else
-            {
-                object.listeners.callExcluding(this,
-                                               &Listener::propertyChanged,
-                                               objectThatChanged,
-                                               propertyName);
-            }
+            child.parent = &object;
+            child.addListener(*this);
         }
 
-    private:
-        juce::Array<Object*> findNestedObjects()
+        void detach(Object& child)
         {
-            juce::Array<Object*> nestedObjects;
+            child.removeListener(*this);
 
-            for (auto& [name, value] : object.getProperties())
-            {
-                if (auto* nested = dynamic_cast<Object*>(value.getDynamicObject()))
-                {
-                    nestedObjects.add(nested);
-                }
-            }
+            if (child.parent == &object)
+                child.parent = nullptr;
+        }
+
+        void propertyChanged(Object& objectThatChanged,
+                             const juce::Identifier& propertyName) final
+        {
+            object.listeners.callExcluding(this,
+                                           &Listener::propertyChanged,
+                                           objectThatChanged,
+                                           propertyName);
+        }
 
-            return nestedObjects;
+        void keyPathChanged(Object& child, const KeyPath& path) final
+        {
+            const auto childEntry = std::find_if(std::begin(object.children),
+                                                 std::end(object.children),
+                                                 [&child](const auto& c) {
+                                                     return c.object.get() == &child;
+                                                 });
+
+            if (childEntry == std::end(object.children))
+                return;
+
+            auto pathFromObject = path;
+            pathFromObject.insert(0, childEntry->propertyName);
+            object.listeners.callExcluding(this,
+                                           &Listener::keyPathChanged,
+                                           object,
+                                           pathFromObject);
         }
 
+    private:
         Object& object;
     };
 
@@ -66,18 +83,22 @@ namespace jive
 
     Object::Object(const Object& other)
         : juce::DynamicObject{ dynamic_cast<const DynamicObject&>(other) }
+        , children{ collectChildren() }
         , internalListener{ std::make_unique<InternalListener>(*this) }
     {
     }
 
     Object::Object(Object&& other)
         : juce::DynamicObject{ std::move(dynamic_cast<DynamicObject&&>(other)) }
+        , children{ collectChildren() }
         , internalListener{ std::make_unique<InternalListener>(*this) }
     {
     }
 
     Object::Object(const juce::DynamicObject& other)
         : juce::DynamicObject{ other }
+        , children{ collectChildren() }
+        , internalListener{ std::make_unique<InternalListener>(*this) }
     {
     }
 
@@ -92,7 +113,11 @@ namespace jive
             childObject->parent = this;
         }
 
-        listeners.call(&Listener::propertyChanged, *this, propertyName);
+        if (propertyName == ids::fontSize)
+            PropertyHub::fontSizesChanged();
+
+        updateChild(propertyName, newValue.value_or(juce::var{}));
+        notifyListeners(propertyName);
     }
 #else
     void Object::setProperty(const juce::Identifier& propertyName,
@@ -105,7 +130,25 @@ namespace jive
                                          .set(propertyName, newValue);
 
         if (propertyChanged)
-            listeners.call(&Listener::propertyChanged, *this, propertyName);
+        {
+            if (propertyName == ids::fontSize)
+                PropertyHub::fontSizesChanged();
+
+            updateChild(propertyName, newValue);
+            notifyListeners(propertyName);
+        }
+    }
+
+    void Object::removeProperty(const juce::Identifier& propertyName)
+    {
+        if (DynamicObject::getProperties().remove(propertyName))
+        {
+            if (propertyName == ids::fontSize)
+                PropertyHub::fontSizesChanged();
+
+            updateChild(propertyName, juce::var{});
+            notifyListeners(propertyName);
+        }
     }
 #endif
 
@@ -140,6 +183,24 @@ namespace jive
         return parent->getRoot();
     }
 
+    int Object::getNumChildren() const noexcept
+    {
+        return static_cast<int>(std::size(children));
+    }
+
+    Object* Object::getChild(int index) noexcept
+    {
+        if (juce::isPositiveAndBelow(index, getNumChildren()))
+            return children[static_cast<std::size_t>(index)].object.get();
+
+        return nullptr;
+    }
+
+    const Object* Object::getChild(int index) const noexcept
+    {
+        return const_cast<Object*>(this)->getChild(index);
+    }
+
     void Object::addListener(Listener& listener) const
     {
         listeners.add(&listener);
@@ -155,6 +216,73 @@ namespace jive
         return getProperties()[name];
     }
 
+    std::vector<Object::Child> Object::collectChildren() const
+    {
+        std::vector<Child> result;
+
+        for (const auto& [name, value] : getProperties())
+        {
+            if (auto* child = dynamic_cast<Object*>(value.getDynamicObject()))
+                result.push_back({ name, child });
+        }
+
+        return result;
+    }
+
+    void Object::updateChild(const juce::Identifier& propertyName, const juce::var& newValue)
+    {
+        auto& listener = static_cast<InternalListener&>(*internalListener);
+        ReferenceCountedPointer newChild = dynamic_cast<Object*>(newValue.getDynamicObject());
+        const auto existingChild = std::find_if(std::begin(children),
+                                                std::end(children),
+                                                [&propertyName](const auto& child) {
+                                                    return child.propertyName == propertyName;
+                                                });
+
+        if (existingChild != std::end(children))
+        {
+            if (existingChild->object == newChild)
+                return;
+
+            listener.detach(*existingChild->object);
+
+            if (newChild != nullptr)
+            {
+                existingChild->object = newChild;
+                listener.attach(*newChild);
+            }
+            else
+            {
+                children.erase(existingChild);
+            }
+
+            return;
+        }
+
+        if (newChild == nullptr)
+            return;
+
+        listener.attach(*newChild);
+
+        // New properties are appended to the end of the set, so the child
+        // only needs slotting in elsewhere when an existing property that
+        // didn't previously hold an object now does.
+        const auto& properties = getProperties();
+
+        if (properties.getName(properties.size() - 1) == propertyName)
+            children.push_back({ propertyName, newChild });
+        else
+            children = collectChildren();
+    }
+
+    void Object::notifyListeners(const juce::Identifier& propertyName)
+    {
+        listeners.call(&Listener::propertyChanged, *this, propertyName);
+
+        if (!listeners.isEmpty())
+            listeners.call(&Listener::keyPathChanged, *this, KeyPath{ propertyName });
+    }
+
     static void replaceDynamicObjectsWithJiveObjects(juce::var& value)
     {
         if (auto* dynamicObject = value.getDynamicObject())
@@ -220,6 +348,8 @@ public:
         testListener();
         testJsonParsing();
         testInitialiserListConstruction();
+        testChildren();
+        testKeyPaths();
     }
 
 private:
@@ -231,7 +361,18 @@ private:
                 onPropertyChange();
         }
 
+        void keyPathChanged(jive::Object&, const jive::Object::KeyPath& path) final
+        {
+            juce::StringArray names;
+
+            for (const auto& name : path)
+                names.add(name.toString());
+
+            changedPaths.add(names.joinIntoString("/"));
+        }
+
         std::function<void()> onPropertyChange = nullptr;
+        juce::StringArray changedPaths;
     };
 
     void testListener()
@@ -334,6 +475,89 @@ private:
         expectEquals(object["bar"], juce::var{ 20 });
         expectEquals(object["wizz"]["bang"], juce::var{ 30 });
     }
+
+    void testChildren()
+    {
+        beginTest("children");
+
+        jive::Object object{
+            { "foo", new jive::Object{} },
+            { "bar", 20 },
+            { "wizz", new jive::Object{} },
+        };
+        expectEquals(object.getNumChildren(), 2);
+        expect(object.getChild(0) == object["foo"].getDynamicObject());
+        expect(object.getChild(1) == object["wizz"].getDynamicObject());
+        expect(object.getChild(2) == nullptr);
+
+        object.setProperty("bar", new jive::Object{});
+        expectEquals(object.getNumChildren(), 3);
+        expect(object.getChild(1) == object["bar"].getDynamicObject());
+
+        object.setProperty("bang", new jive::Object{});
+        expectEquals(object.getNumChildren(), 4);
+        expect(object.getChild(3) == object["bang"].getDynamicObject());
+
+        object.setProperty("foo", 10);
+        object.removeProperty("wizz");
+        expectEquals(object.getNumChildren(), 2);
+        expect(object.getChild(0) == object["bar"].getDynamicObject());
+        expect(object.getChild(1) == object["bang"].getDynamicObject());
+
+        const jive::Object copy{ object };
+        expectEquals(copy.getNumChildren(), 2);
+        expect(copy.getChild(1) == object["bang"].getDynamicObject());
+    }
+
+    void testKeyPaths()
+    {
+        beginTest("key paths");
+
+        auto style = jive::parseJSON(R"(
+            {
+                "background": "red",
+                "hover": {
+                    ".primary": {
+                        "background": "blue",
+                    },
+                },
+            }
+        )");
+        auto* root = dynamic_cast<jive::Object*>(style.getDynamicObject());
+        auto* hover = root->getChild(0);
+        auto* primary = hover->getChild(0);
+
+        Listener listener;
+        root->addListener(listener);
+
+        root->setProperty("background", "green");
+        primary->setProperty("background", "yellow");
+        hover->setProperty("foreground", "black");
+        expectEquals(listener.changedPaths.joinIntoString(","),
+                     juce::String{ "background,hover/.primary/background,hover/foreground" });
+
+        listener.changedPaths.clear();
+        jive::Object::ReferenceCountedPointer oldHover = hover;
+        root->setProperty("hover",
+                          new jive::Object{
+                              { "background", "white" },
+                          });
+        oldHover->setProperty("background", "grey");
+        root->getChild(0)->setProperty("background", "pink");
+        expectEquals(listener.changedPaths.joinIntoString(","),
+                     juce::String{ "hover,hover/background" });
+        expect(oldHover->getParent() == nullptr);
+        expect(root->getChild(0)->getParent() == root);
+
+        listener.changedPaths.clear();
+        root->removeProperty("hover");
+        oldHover = nullptr;
+        root->setProperty("foreground", "black");
+        expectEquals(listener.changedPaths.joinIntoString(","),
+                     juce::String{ "hover,foreground" });
+
+        root->removeListener(listener);
+    }
 };
 
 static ObjectTest objectTest;
@@ -11,12 +11,27 @@ namespace jive
     public:
         using ReferenceCountedPointer = juce::ReferenceCountedObjectPtr<Object>;
 
+        /** The names of the properties leading from one object, through any
+            objects nested within it, to a property - e.g. { "hover",
+            ".primary", "background" }.
+        */
+        using KeyPath = juce::Array<juce::Identifier>;
+
         struct Listener
         {
             virtual ~Listener() = default;
 
             virtual void propertyChanged(Object& object,
                                          const juce::Identifier& propertyName) = 0;
+
+            /** Called after propertyChanged(), with the object being listened
+                to and the path from it to the property that changed, which
+                might belong to an object nested within it.
+            */
+            virtual void keyPathChanged(Object& object, const KeyPath& path)
+            {
+                juce::ignoreUnused(object, path);
+            }
         };
 
         Object();
@@ -31,9 +46,11 @@ namespace jive
 #elif JUCE_VERSION >= JIVE_JUCE_VERSION(8, 0, 2)
         void setProperty(const juce::Identifier& propertyName,
                          const juce::var& newValue);
+        void removeProperty(const juce::Identifier& propertyName);
 #else
         void setProperty(const juce::Identifier& propertyName,
                          const juce::var& newValue) override;
+        void removeProperty(const juce::Identifier& propertyName) override;
 #endif
         const juce::NamedValueSet& getProperties() const;
 
@@ -42,6 +59,13 @@ namespace jive
         Object* getRoot() noexcept;
         const Object* getRoot() const noexcept;
 
+        /** The nested objects held by this object's properties, in the order
+            their properties were added.
+        */
+        int getNumChildren() const noexcept;
+        Object* getChild(int index) noexcept;
+        const Object* getChild(int index) const noexcept;
+
         void addListener(Listener& listener) const;
         void removeListener(Listener& listener) const;
 
@@ -50,7 +74,18 @@ namespace jive
     private:
         class InternalListener;
 
+        struct Child
+        {
+            juce::Identifier propertyName;
+            ReferenceCountedPointer object;
+        };
+
+        [[nodiscard]] std::vector<Child> collectChildren() const;
+        void updateChild(const juce::Identifier& propertyName, const juce::var& newValue);
+        void notifyListeners(const juce::Identifier& propertyName);
+
         mutable juce::ListenerList<Listener> listeners;
+        std::vector<Child> children;
         const std::unique_ptr<Listener> internalListener;
         Object* parent = nullptr;
 
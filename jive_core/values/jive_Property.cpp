@@ -19,6 +19,7 @@ public:
         testFunctionalProperties();
         testDynamicObjectSource();
         testTransitions();
+        testValueCaching();
     }
 
 private:
@@ -445,6 +446,39 @@ private:
             expectEquals(value.getTransition()->calculateCurrent<double>(), 200.0);
         }
     }
+
+    void testValueCaching()
+    {
+        beginTest("value caching");
+
+        juce::ValueTree tree{ "Tree", { { "value", "1 2 3" } } };
+        jive::Property<juce::StringArray> value{ tree, "value" };
+        jive::PropertyCacheStatistics::reset();
+
+        expect(value.get() == juce::StringArray{ "1", "2", "3" });
+        expectEquals(static_cast<int>(jive::PropertyCacheStatistics::getNumMisses()), 1);
+        expectEquals(static_cast<int>(jive::PropertyCacheStatistics::getNumHits()), 0);
+
+        expect(value.get() == juce::StringArray{ "1", "2", "3" });
+        expectEquals(static_cast<int>(jive::PropertyCacheStatistics::getNumMisses()), 1);
+        expectEquals(static_cast<int>(jive::PropertyCacheStatistics::getNumHits()), 1);
+        expectEquals(jive::PropertyCacheStatistics::getHitRate(), 0.5);
+
+        tree.setProperty("value", "4 5", nullptr);
+        expect(value.get() == juce::StringArray{ "4", "5" });
+
+        tree.removeProperty("value", nullptr);
+        expect(value.get().isEmpty());
+
+        tree.setProperty("value",
+                         juce::var{
+                             [](const auto&) {
+                                 return "6";
+                             },
+                         },
+                         nullptr);
+        expect(value.get() == juce::StringArray{ "6" });
+    }
 };
 
 static PropertyUnitTest propertyUnitTest;
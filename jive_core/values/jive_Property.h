@@ -1,7 +1,10 @@
 #pragma once
 
+#include "jive_Identifiers.h"
 #include "jive_Object.h"
 #include "jive_PropertyBehaviours.h"
+#include "jive_PropertyHub.h"
+#include "jive_ScopedUpdateBatch.h"
 #include "variant-converters/jive_VariantConvertion.h"
 
 #include <jive_core/algorithms/jive_Visitor.h>
@@ -19,13 +22,60 @@ namespace jive
     {
     };
 
+    /** Counts how often a Property was able to return its previously
+        converted value instead of converting the underlying var again.
+    */
+    struct PropertyCacheStatistics
+    {
+        static void recordHit() noexcept
+        {
+            hits.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        static void recordMiss() noexcept
+        {
+            misses.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] static std::uint64_t getNumHits() noexcept
+        {
+            return hits.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] static std::uint64_t getNumMisses() noexcept
+        {
+            return misses.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] static double getHitRate() noexcept
+        {
+            const auto numHits = getNumHits();
+            const auto numLookups = numHits + getNumMisses();
+
+            if (numLookups == 0)
+                return 0.0;
+
+            return static_cast<double>(numHits) / static_cast<double>(numLookups);
+        }
+
+        static void reset() noexcept
+        {
+            hits.store(0, std::memory_order_relaxed);
+            misses.store(0, std::memory_order_relaxed);
+        }
+
+    private:
+        static inline std::atomic<std::uint64_t> hits{ 0 };
+        static inline std::atomic<std::uint64_t> misses{ 0 };
+    };
+
     template <typename ValueType,
               Inheritance inheritance = Inheritance::doNotInherit,
               Accumulation accumulation = Accumulation::doNotAccumulate,
               bool autoParseStrings = isReferenceCountedObjectPointer<ValueType>::value,
               Responsiveness responsiveness = Responsiveness::respondToChanges>
     class Property
-        : protected juce::ValueTree::Listener
+        : protected PropertyHub::Subscriber
         , protected Object::Listener
         , private Transition::Listener
     {
@@ -56,7 +106,9 @@ namespace jive
         Property& operator=(const Property& other)
         {
             jassert(id == other.id);
+            stopObservingSource();
             transitionSourceID = other.transitionSourceID;
+            transitionsSource = other.transitionsSource;
             source = other.source;
             onValueChange = other.onValueChange;
 
@@ -68,7 +120,9 @@ namespace jive
         Property& operator=(Property&& other)
         {
             jassert(id == other.id);
+            stopObservingSource();
             transitionSourceID = std::move(other.transitionSourceID);
+            transitionsSource = std::move(other.transitionsSource);
             source = std::move(other.source);
             onValueChange = std::move(other.onValueChange);
 
@@ -79,13 +133,43 @@ namespace jive
 
         ~Property() override
         {
+            ScopedUpdateBatch::cancel(this, id);
             observeTransition(nullptr);
-            removeThisAsListener(source);
-            removeThisAsListener(listenerTarget);
+            stopObservingSource();
         }
 
         [[nodiscard]] ValueType get() const
         {
+            if constexpr (cachesValues)
+            {
+                if (cachedValue.has_value())
+                {
+                    PropertyCacheStatistics::recordHit();
+                    return *cachedValue;
+                }
+
+                if (std::holds_alternative<juce::ValueTree>(source))
+                {
+                    PropertyCacheStatistics::recordMiss();
+                    const auto root = getRootOfInheritance();
+
+                    // Functional values and values borrowed from descendants
+                    // can change without this property being told about it.
+                    if (const auto& rootTree = std::get<juce::ValueTree>(root);
+                        rootTree.isValid())
+                    {
+                        if (const auto& var = rootTree.getProperty(id);
+                            !var.isVoid() && !var.isMethod())
+                        {
+                            cachedValue.emplace(fromVar<ValueType>(var));
+                            return *cachedValue;
+                        }
+                    }
+
+                    return getFrom(root);
+                }
+            }
+
             return getFrom(getRootOfInheritance());
         }
 
@@ -204,18 +288,28 @@ namespace jive
                 observeTransition(transition);
         }
 
+        /** Follows the transition for the given property of another source,
+            for values that are derived from that source but stored elsewhere.
+        */
+        void setTransitionSourceProperty(const Source& sourceOfTransitions,
+                                         const juce::Identifier& sourceID)
+        {
+            stopObservingSource();
+            transitionsSource = sourceOfTransitions;
+            currentTransition = nullptr;
+
+            if constexpr (responsiveness == Responsiveness::respondToChanges)
+                startObservingSource();
+
+            setTransitionSourceProperty(sourceID);
+        }
+
         [[nodiscard]] Transition* getTransition()
         {
             if (currentTransition == nullptr)
             {
-                using TransitionsProperty = Property<Transitions::ReferenceCountedPointer,
-                                                     Inheritance::doNotInherit,
-                                                     Accumulation::doNotAccumulate,
-                                                     true,
-                                                     Responsiveness::ignoreChanges>;
-
-                if (const TransitionsProperty transitions{ source, "transition" }; transitions.exists())
-                    currentTransition = (*transitions.get())[transitionSourceID.toString()];
+                if (const auto transitions = findTransitions(); transitions != nullptr)
+                    currentTransition = (*transitions)[transitionSourceID.toString()];
             }
 
             if (currentTransition != nullptr && currentTransition->source.isVoid())
@@ -266,32 +360,45 @@ namespace jive
         mutable std::function<void(void)> onTransitionProgressed = nullptr;
 
     protected:
-        void valueTreePropertyChanged(juce::ValueTree& treeWhosePropertyChanged,
-                                      const juce::Identifier& property) override
+        void subscribedPropertyChanged(juce::ValueTree& treeWhosePropertyChanged,
+                                       const juce::Identifier& property) override
         {
             if (property != id)
             {
-                if (property.toString() == "transition")
+                if (property == ids::transition)
                     currentTransition = getTransition();
 
                 return;
             }
+
+            cachedValue.reset();
+
             if (!treeWhosePropertyChanged.hasProperty(property))
                 return;
             if (!respondToPropertyChanges(treeWhosePropertyChanged))
                 return;
 
-            valueChanged();
+            const auto notify = [this] {
+                valueChanged();
 
-            if (onValueChange != nullptr)
-                onValueChange();
+                if (onValueChange != nullptr)
+                    onValueChange();
+            };
+
+            if (!ScopedUpdateBatch::defer(std::get<juce::ValueTree>(source), this, id, notify))
+                notify();
         }
 
         void propertyChanged(Object& objectWhosePropertyChanged,
                              const juce::Identifier& property) override
         {
             if (property != id)
+            {
+                if (property == ids::transition)
+                    currentTransition = getTransition();
+
                 return;
+            }
             if (!objectWhosePropertyChanged.hasProperty(property))
                 return;
 
@@ -319,7 +426,9 @@ namespace jive
             switch (accumulation)
             {
             case Accumulation::accumulate:
-                return treeWhosePropertyChanged.isAChildOf(std::get<juce::ValueTree>(source));
+                // Subtree subscriptions only deliver changes from within the
+                // source's subtree.
+                return true;
             case Accumulation::doNotAccumulate:
                 break;
             }
@@ -334,6 +443,13 @@ namespace jive
 
         [[nodiscard]] auto getRootOfInheritance() const
         {
+            if constexpr (inheritance == Inheritance::inheritFromAncestors
+                          && accumulation == Accumulation::doNotAccumulate)
+            {
+                if (sourceHub != nullptr)
+                    return Source{ sourceHub->findInheritanceRoot(id) };
+            }
+
             if (exists() || accumulation == Accumulation::accumulate)
                 return source;
 
@@ -361,6 +477,9 @@ namespace jive
 
         [[nodiscard]] auto getFirstDescendantWithProperty(const Source& root) const
         {
+            if (isIndexedBySourceHub(root))
+                return Source{ sourceHub->findFirstDescendantWithProperty(id) };
+
             for (auto i = 0; i < getNumChildren(root); i++)
             {
                 if (auto child = getChild(root, i); !getVar(child, id).isVoid())
@@ -388,6 +507,14 @@ namespace jive
             {
                 auto result = fromVar<ValueType>(getVar(root, id));
 
+                if (isIndexedBySourceHub(root))
+                {
+                    for (const auto& descendant : sourceHub->getDescendantsWithProperty(id))
+                        result += fromVar<ValueType>(descendant[id]);
+
+                    return result;
+                }
+
                 for (auto i = 0; i < getNumChildren(root); i++)
                     result += getFrom(getChild(root, i));
 
@@ -446,6 +573,17 @@ namespace jive
                               root);
         }
 
+        [[nodiscard]] auto isIndexedBySourceHub(const Source& root) const
+        {
+            if (sourceHub == nullptr)
+                return false;
+
+            if (const auto* rootTree = std::get_if<juce::ValueTree>(&root))
+                return *rootTree == sourceHub->getTree();
+
+            return false;
+        }
+
         [[nodiscard]] auto isValid(const Source& src) const
         {
             return std::visit(Visitor{
@@ -498,11 +636,7 @@ namespace jive
                                       if (sourceObject == nullptr)
                                           return 0;
 
-                                      return static_cast<int>(std::count_if(std::begin(sourceObject->getProperties()),
-                                                                            std::end(sourceObject->getProperties()),
-                                                                            [](const auto& property) {
-                                                                                return dynamic_cast<const Object*>(property.value.getDynamicObject()) != nullptr;
-                                                                            }));
+                                      return sourceObject->getNumChildren();
                                   },
                               },
                               src);
@@ -518,18 +652,7 @@ namespace jive
                                       if (sourceObject == nullptr)
                                           return nullptr;
 
-                                      auto current = 0;
-
-                                      for (const auto& [_, value] : sourceObject->getProperties())
-                                      {
-                                          if (auto* child = dynamic_cast<Object*>(value.getDynamicObject()))
-                                          {
-                                              if (current++ == index)
-                                                  return child;
-                                          }
-                                      }
-
-                                      return nullptr;
+                                      return sourceObject->getChild(index);
                                   },
                               },
                               src);
@@ -564,32 +687,94 @@ namespace jive
                               src);
         }
 
-        void addThisAsListener(Source& src)
+        void startObservingSource()
         {
             std::visit(Visitor{
-                           [this](juce::ValueTree& sourceTree) {
-                               sourceTree.addListener(this);
+                           [this](const juce::ValueTree& sourceTree) {
+                               sourceHub = PropertyHub::getFor(sourceTree);
+
+                               if constexpr (inheritance == Inheritance::inheritFromParent)
+                                   targetHub = PropertyHub::getFor(std::get<juce::ValueTree>(listenerTarget));
+
+                               forEachSubscription([this](PropertyHub& hub,
+                                                          const juce::Identifier& propertyName,
+                                                          PropertyHub::Scope scope) {
+                                   hub.subscribe(propertyName, *this, scope);
+                               });
                            },
-                           [this](const Object::ReferenceCountedPointer& sourceObject) {
-                               if (sourceObject != nullptr)
-                                   sourceObject->addListener(*this);
+                           [this](const Object::ReferenceCountedPointer&) {
+                               if (auto& target = std::get<Object::ReferenceCountedPointer>(listenerTarget);
+                                   target != nullptr)
+                               {
+                                   target->addListener(*this);
+                               }
                            },
                        },
-                       src);
-        }
+                       source);
 
-        void removeThisAsListener(Source& src)
-        {
             std::visit(Visitor{
-                           [this](juce::ValueTree& sourceTree) {
-                               sourceTree.removeListener(this);
+                           [this](const juce::ValueTree& transitionsTree) {
+                               transitionsHub = PropertyHub::getFor(transitionsTree);
+
+                               if (transitionsHub != nullptr)
+                                   transitionsHub->subscribe(ids::transition, *this);
                            },
-                           [this](const Object::ReferenceCountedPointer& sourceObject) {
-                               if (sourceObject != nullptr)
-                                   sourceObject->removeListener(*this);
+                           [this](const Object::ReferenceCountedPointer& transitionsObject) {
+                               if (transitionsObject != nullptr)
+                                   transitionsObject->addListener(*this);
                            },
                        },
-                       src);
+                       transitionsSource);
+        }
+
+        void stopObservingSource()
+        {
+            forEachSubscription([this](PropertyHub& hub,
+                                       const juce::Identifier& propertyName,
+                                       PropertyHub::Scope scope) {
+                hub.unsubscribe(propertyName, *this, scope);
+            });
+
+            if (transitionsHub != nullptr)
+                transitionsHub->unsubscribe(ids::transition, *this);
+
+            sourceHub = nullptr;
+            targetHub = nullptr;
+            transitionsHub = nullptr;
+
+            for (auto* src : { &source, &listenerTarget, &transitionsSource })
+            {
+                if (auto* sourceObject = std::get_if<Object::ReferenceCountedPointer>(src);
+                    sourceObject != nullptr && *sourceObject != nullptr)
+                {
+                    (*sourceObject)->removeListener(*this);
+                }
+            }
+        }
+
+        template <typename Callback>
+        void forEachSubscription(Callback&& callback)
+        {
+            if (sourceHub == nullptr)
+                return;
+
+            callback(*sourceHub, ids::transition, PropertyHub::Scope::node);
+
+            // The inherited scope covers changes to the source itself, as well
+            // as to any ancestor it would inherit from.
+            if constexpr (inheritance == Inheritance::inheritFromAncestors)
+                callback(*sourceHub, id, PropertyHub::Scope::inherited);
+            else if constexpr (accumulation == Accumulation::doNotAccumulate)
+                callback(*sourceHub, id, PropertyHub::Scope::node);
+
+            if constexpr (accumulation == Accumulation::accumulate)
+                callback(*sourceHub, id, PropertyHub::Scope::subtree);
+
+            if constexpr (inheritance == Inheritance::inheritFromParent)
+            {
+                if (targetHub != nullptr)
+                    callback(*targetHub, id, PropertyHub::Scope::node);
+            }
         }
 
         void set(Source& src, const juce::var& value)
@@ -610,15 +795,62 @@ namespace jive
         Source source;
 
     private:
+        [[nodiscard]] const Source& getTransitionsSource() const
+        {
+            if (isValid(transitionsSource))
+                return transitionsSource;
+
+            return source;
+        }
+
+        [[nodiscard]] Transitions::ReferenceCountedPointer findTransitions()
+        {
+            return std::visit(Visitor{
+                                  [this](const juce::ValueTree& tree) -> Transitions::ReferenceCountedPointer {
+                                      // Properties that ignore changes wouldn't otherwise hold a
+                                      // hub, so this keeps the one caching the tree's transitions
+                                      // alive between lookups.
+                                      if (transitionsHub == nullptr || transitionsHub->getTree() != tree)
+                                          transitionsHub = PropertyHub::getFor(tree);
+
+                                      if (transitionsHub == nullptr)
+                                          return nullptr;
+
+                                      return transitionsHub->getTransitions();
+                                  },
+                                  [](const Object::ReferenceCountedPointer& object) -> Transitions::ReferenceCountedPointer {
+                                      if (object == nullptr)
+                                          return nullptr;
+
+                                      const auto value = object->getProperty(ids::transition);
+                                      auto transitions = fromVar<Transitions::ReferenceCountedPointer>(value);
+
+                                      if (value.isString() && transitions != nullptr)
+                                          object->setProperty(ids::transition, toVar(transitions));
+
+                                      return transitions;
+                                  },
+                              },
+                              getTransitionsSource());
+        }
+
+        // Only properties that are told about every change to their value can
+        // safely hold on to it.
+        static constexpr auto cachesValues = responsiveness == Responsiveness::respondToChanges
+                                          && inheritance != Inheritance::inheritFromParent
+                                          && accumulation == Accumulation::doNotAccumulate;
+
         void initialise()
         {
+            cachedValue.reset();
+
             listenerTarget = findListenerTarget(source);
 
             if (!isValid(listenerTarget))
                 listenerTarget = source;
 
             if constexpr (responsiveness == Responsiveness::respondToChanges)
-                addThisAsListener(listenerTarget);
+                startObservingSource();
 
             if constexpr (autoParseStrings)
             {
@@ -692,8 +924,13 @@ namespace jive
         }
 
         Source listenerTarget;
+        PropertyHub::ReferenceCountedPointer sourceHub;
+        PropertyHub::ReferenceCountedPointer targetHub;
+        PropertyHub::ReferenceCountedPointer transitionsHub;
         juce::Identifier transitionSourceID;
+        Source transitionsSource;
         Transition* currentTransition = nullptr;
         Transition* observedTransition = nullptr;
+        mutable std::optional<ValueType> cachedValue;
     };
 } // namespace jive
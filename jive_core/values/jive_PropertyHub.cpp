@@ -0,0 +1,1192 @@
+#include "jive_PropertyHub.h"
+
+#include "jive_Identifiers.h"
+
+#ifndef JIVE_MIRROR_NATIVE_STATE
+    #define JIVE_MIRROR_NATIVE_STATE 0
+#endif
+
+namespace jive
+{
+    class PropertyHub::NativeState
+        : public Object
+        , private Object::Listener
+    {
+    public:
+        explicit NativeState(PropertyHub& owner)
+            : hub{ &owner }
+        {
+            hub->nativeState = this;
+
+#if JUCE_DEBUG && JIVE_MIRROR_NATIVE_STATE
+            addListener(*this);
+#endif
+        }
+
+        ~NativeState() override
+        {
+#if JUCE_DEBUG && JIVE_MIRROR_NATIVE_STATE
+            removeListener(*this);
+#endif
+
+            hub->nativeState = nullptr;
+        }
+
+    private:
+        void propertyChanged(Object&, const juce::Identifier& propertyName) final
+        {
+            auto tree = hub->getTree();
+
+            if (hasProperty(propertyName))
+                tree.setProperty(propertyName, getProperty(propertyName), nullptr);
+            else
+                tree.removeProperty(propertyName, nullptr);
+        }
+
+        // Holding on to the hub means the node keeps the same native state
+        // for as long as anything is using it.
+        const PropertyHub::ReferenceCountedPointer hub;
+    };
+
+    class PropertyHubRegistry
+    {
+    public:
+        [[nodiscard]] PropertyHub* find(const juce::ValueTree& tree)
+        {
+            for (auto* hub : recentlyUsed)
+            {
+                if (hub != nullptr && hub->getTree() == tree)
+                    return hub;
+            }
+
+            auto* hub = findUncached(tree);
+
+            if (hub != nullptr)
+                markAsRecentlyUsed(*hub);
+
+            return hub;
+        }
+
+        void addRoot(PropertyHub& hub)
+        {
+            rootsByType[hub.getTree().getType()].push_back(&hub);
+            markAsRecentlyUsed(hub);
+        }
+
+        void removeRoot(PropertyHub& hub)
+        {
+            auto& bucket = rootsByType[hub.getTree().getType()];
+            bucket.erase(std::remove(std::begin(bucket), std::end(bucket), &hub),
+                         std::end(bucket));
+        }
+
+        void forget(PropertyHub& hub)
+        {
+            std::replace(std::begin(recentlyUsed),
+                         std::end(recentlyUsed),
+                         &hub,
+                         static_cast<PropertyHub*>(nullptr));
+        }
+
+        [[nodiscard]] static PropertyHubRegistry& getInstance()
+        {
+            static PropertyHubRegistry registry;
+            return registry;
+        }
+
+    private:
+        // ValueTree doesn't expose anything that could be used to hash its
+        // identity, so a node's hub is found through its parent's hub, which
+        // keeps track of its children's hubs by index. Only the hubs of root
+        // nodes need searching, and there are rarely more than a few of
+        // those.
+        [[nodiscard]] PropertyHub* findUncached(const juce::ValueTree& tree)
+        {
+            const auto parent = tree.getParent();
+
+            if (!parent.isValid())
+            {
+                if (const auto bucket = rootsByType.find(tree.getType());
+                    bucket != std::end(rootsByType))
+                {
+                    for (auto* hub : bucket->second)
+                    {
+                        if (hub->getTree() == tree)
+                            return hub;
+                    }
+                }
+
+                return nullptr;
+            }
+
+            // Every hub keeps its parent node's hub alive, so a node can't
+            // have a hub if its parent doesn't.
+            auto* parentHub = find(parent);
+
+            if (parentHub == nullptr)
+                return nullptr;
+
+            const auto index = parent.indexOf(tree);
+
+            if (!juce::isPositiveAndBelow(index, std::size(parentHub->childHubs)))
+                return nullptr;
+
+            auto* hub = parentHub->childHubs[static_cast<std::size_t>(index)];
+            jassert(hub == nullptr || hub->getTree() == tree);
+            return hub;
+        }
+
+        void markAsRecentlyUsed(PropertyHub& hub)
+        {
+            recentlyUsed[nextRecentlyUsedIndex] = &hub;
+            nextRecentlyUsedIndex = (nextRecentlyUsedIndex + 1) % std::size(recentlyUsed);
+        }
+
+        // Properties are almost always created in batches for the same few
+        // nodes, so a handful of the most recently used hubs are checked
+        // first.
+        std::unordered_map<juce::Identifier, std::vector<PropertyHub*>> rootsByType;
+        std::array<PropertyHub*, 8> recentlyUsed{};
+        std::size_t nextRecentlyUsedIndex = 0;
+    };
+
+    [[nodiscard]] static int getDepth(juce::ValueTree node)
+    {
+        auto depth = 0;
+
+        for (node = node.getParent(); node.isValid(); node = node.getParent())
+            depth++;
+
+        return depth;
+    }
+
+    // Compares the nodes' positions in a depth-first walk of their tree
+    // without allocating. Both nodes are walked up to their closest common
+    // ancestor, so only that ancestor's children need searching.
+    [[nodiscard]] static bool isBeforeInTree(juce::ValueTree first, juce::ValueTree second)
+    {
+        const auto firstDepth = getDepth(first);
+        const auto secondDepth = getDepth(second);
+
+        for (auto depth = firstDepth; depth > secondDepth; depth--)
+            first = first.getParent();
+
+        for (auto depth = secondDepth; depth > firstDepth; depth--)
+            second = second.getParent();
+
+        // One node is an ancestor of the other, and ancestors come first.
+        if (first == second)
+            return firstDepth < secondDepth;
+
+        while (first.getParent() != second.getParent())
+        {
+            first = first.getParent();
+            second = second.getParent();
+        }
+
+        for (const auto& sibling : first.getParent())
+        {
+            if (sibling == first)
+                return true;
+
+            if (sibling == second)
+                return false;
+        }
+
+        jassertfalse;
+        return false;
+    }
+
+    [[nodiscard]] static bool isWithin(const juce::ValueTree& node, const juce::ValueTree& root)
+    {
+        return node == root || node.isAChildOf(root);
+    }
+
+    static void collectTreesWithProperty(const juce::ValueTree& root,
+                                         const juce::Identifier& propertyName,
+                                         std::vector<juce::ValueTree>& result)
+    {
+        if (root.hasProperty(propertyName))
+            result.push_back(root);
+
+        for (const auto& child : root)
+            collectTreesWithProperty(child, propertyName, result);
+    }
+
+    PropertyHub::PropertyHub(const juce::ValueTree& sourceTree)
+        : tree{ sourceTree }
+        , childHubs(static_cast<std::size_t>(tree.getNumChildren()), nullptr)
+    {
+        tree.addListener(this);
+
+        if (const auto parent = tree.getParent(); parent.isValid())
+            setParentHub(getFor(parent));
+        else
+            PropertyHubRegistry::getInstance().addRoot(*this);
+    }
+
+    PropertyHub::~PropertyHub()
+    {
+        if (parentHub != nullptr)
+        {
+            for (const auto& propertyName : inheritedPropertyNames)
+                parentHub->removeInheritingChild(propertyName, *this);
+
+            std::replace(std::begin(parentHub->childHubs),
+                         std::end(parentHub->childHubs),
+                         this,
+                         static_cast<PropertyHub*>(nullptr));
+        }
+        else
+        {
+            PropertyHubRegistry::getInstance().removeRoot(*this);
+        }
+
+        PropertyHubRegistry::getInstance().forget(*this);
+        tree.removeListener(this);
+    }
+
+    void PropertyHub::setParentHub(ReferenceCountedPointer newParentHub)
+    {
+        if (newParentHub == parentHub)
+            return;
+
+        auto& registry = PropertyHubRegistry::getInstance();
+
+        if (parentHub != nullptr)
+        {
+            for (const auto& propertyName : inheritedPropertyNames)
+                parentHub->removeInheritingChild(propertyName, *this);
+
+            // The old parent normally forgets this hub when the node is
+            // removed from it, but not if it only had a hub created since.
+            std::replace(std::begin(parentHub->childHubs),
+                         std::end(parentHub->childHubs),
+                         this,
+                         static_cast<PropertyHub*>(nullptr));
+        }
+        else
+        {
+            registry.removeRoot(*this);
+        }
+
+        if (newParentHub != nullptr)
+        {
+            const auto index = static_cast<std::size_t>(newParentHub->tree.indexOf(tree));
+            jassert(index < std::size(newParentHub->childHubs));
+
+            if (index < std::size(newParentHub->childHubs))
+                newParentHub->childHubs[index] = this;
+
+            for (const auto& propertyName : inheritedPropertyNames)
+                newParentHub->addInheritingChild(propertyName, *this);
+        }
+        else
+        {
+            registry.addRoot(*this);
+        }
+
+        parentHub = newParentHub;
+    }
+
+    void PropertyHub::subscribe(const juce::Identifier& propertyName,
+                                Subscriber& subscriber,
+                                Scope scope)
+    {
+        getSubscribers(scope)[propertyName].add(&subscriber);
+
+        if (scope == Scope::inherited)
+            updateInheritanceLink(propertyName);
+    }
+
+    void PropertyHub::unsubscribe(const juce::Identifier& propertyName,
+                                  Subscriber& subscriber,
+                                  Scope scope)
+    {
+        auto& subscribers = getSubscribers(scope);
+
+        // Entries are deliberately left in place once empty - a subscriber
+        // may unsubscribe while its entry is being iterated.
+        if (const auto entry = subscribers.find(propertyName);
+            entry != std::end(subscribers))
+        {
+            entry->second.remove(&subscriber);
+        }
+
+        if (scope == Scope::inherited)
+            updateInheritanceLink(propertyName);
+
+        if (scope == Scope::subtree)
+        {
+            if (const auto entry = subtreeSubscribers.find(propertyName);
+                entry == std::end(subtreeSubscribers) || entry->second.isEmpty())
+            {
+                descendantIndex.erase(propertyName);
+            }
+        }
+    }
+
+    const juce::ValueTree& PropertyHub::getTree() const noexcept
+    {
+        return tree;
+    }
+
+    juce::ValueTree PropertyHub::findInheritanceRoot(const juce::Identifier& propertyName)
+    {
+        if (const auto root = inheritanceRoots.find(propertyName);
+            root != std::end(inheritanceRoots))
+        {
+            return root->second;
+        }
+
+        juce::ValueTree root;
+
+        for (auto node = tree; node.isValid(); node = node.getParent())
+        {
+            if (node.hasProperty(propertyName))
+            {
+                root = node;
+                break;
+            }
+        }
+
+        // Without inherited-scope subscribers nothing would tell this hub
+        // when the result goes stale.
+        if (inheritedPropertyNames.count(propertyName) > 0)
+            inheritanceRoots[propertyName] = root;
+
+        return root;
+    }
+
+    Object::ReferenceCountedPointer PropertyHub::getNativeState()
+    {
+        if (nativeState != nullptr)
+            return nativeState;
+
+        return new NativeState{ *this };
+    }
+
+    Transitions::ReferenceCountedPointer PropertyHub::getTransitions()
+    {
+        if (transitions.has_value())
+            return *transitions;
+
+        const auto value = tree[ids::transition];
+        auto parsedTransitions = juce::VariantConverter<Transitions::ReferenceCountedPointer>::fromVar(value);
+
+        // Storing the parsed object notifies this hub, clearing the cache, so
+        // it's only filled in afterwards.
+        if (value.isString() && parsedTransitions != nullptr)
+            tree.setProperty(ids::transition, parsedTransitions.get(), nullptr);
+
+        transitions = parsedTransitions;
+        return parsedTransitions;
+    }
+
+    const std::vector<juce::ValueTree>& PropertyHub::getDescendantsWithProperty(const juce::Identifier& propertyName)
+    {
+        if (const auto entry = descendantIndex.find(propertyName);
+            entry != std::end(descendantIndex))
+        {
+            return entry->second;
+        }
+
+        auto& descendants = descendantIndex[propertyName];
+
+        for (const auto& child : tree)
+            collectTreesWithProperty(child, propertyName, descendants);
+
+        return descendants;
+    }
+
+    juce::ValueTree PropertyHub::findFirstDescendantWithProperty(const juce::Identifier& propertyName)
+    {
+        const auto& descendants = getDescendantsWithProperty(propertyName);
+        auto first = std::begin(descendants);
+        auto last = std::end(descendants);
+
+        for (auto root = tree; first != last;)
+        {
+            if (const auto child = std::find_if(first,
+                                                last,
+                                                [&root](const auto& descendant) {
+                                                    return descendant.getParent() == root;
+                                                });
+                child != last)
+            {
+                return *child;
+            }
+
+            // None of the root's children have the property, so narrow the
+            // search down to the child containing the first descendant that
+            // does.
+            auto nextRoot = *first;
+
+            while (nextRoot.getParent() != root)
+                nextRoot = nextRoot.getParent();
+
+            root = nextRoot;
+            last = std::find_if(first,
+                                last,
+                                [&root](const auto& descendant) {
+                                    return !descendant.isAChildOf(root);
+                                });
+        }
+
+        return {};
+    }
+
+    static std::uint64_t fontSizeGeneration = 0;
+
+    std::uint64_t PropertyHub::getFontSizeGeneration() noexcept
+    {
+        return fontSizeGeneration;
+    }
+
+    void PropertyHub::fontSizesChanged() noexcept
+    {
+        fontSizeGeneration++;
+    }
+
+    PropertyHub::ReferenceCountedPointer PropertyHub::getFor(const juce::ValueTree& tree)
+    {
+        if (!tree.isValid())
+            return nullptr;
+
+        if (auto* existingHub = PropertyHubRegistry::getInstance().find(tree))
+            return existingHub;
+
+        return new PropertyHub{ tree };
+    }
+
+    void PropertyHub::valueTreePropertyChanged(juce::ValueTree& treeWhosePropertyChanged,
+                                               const juce::Identifier& propertyName)
+    {
+        // Subscribers may release the last reference to this hub from within
+        // their callbacks.
+        const ReferenceCountedPointer keepAlive{ this };
+
+        if (propertyName == ids::style)
+            fontSizesChanged();
+
+        if (treeWhosePropertyChanged != tree)
+            updateDescendantIndex(treeWhosePropertyChanged, propertyName);
+
+        if (treeWhosePropertyChanged == tree)
+        {
+            if (propertyName == ids::transition)
+                transitions.reset();
+
+            if (const auto entry = nodeSubscribers.find(propertyName);
+                entry != std::end(nodeSubscribers))
+            {
+                entry->second.call(&Subscriber::subscribedPropertyChanged,
+                                   treeWhosePropertyChanged,
+                                   propertyName);
+            }
+
+            if (inheritedPropertyNames.count(propertyName) > 0)
+                inheritedPropertyChanged(treeWhosePropertyChanged, propertyName);
+        }
+
+        if (const auto entry = subtreeSubscribers.find(propertyName);
+            entry != std::end(subtreeSubscribers))
+        {
+            entry->second.call(&Subscriber::subscribedPropertyChanged,
+                               treeWhosePropertyChanged,
+                               propertyName);
+        }
+    }
+
+    void PropertyHub::valueTreeParentChanged(juce::ValueTree& treeWhoseParentChanged)
+    {
+        // JUCE sends this to every node in a subtree that was moved, so each
+        // hub only needs to deal with its own node.
+        if (treeWhoseParentChanged != tree)
+            return;
+
+        // The node may now inherit its font size from a different ancestor.
+        fontSizesChanged();
+
+        const ReferenceCountedPointer keepAlive{ this };
+
+        // The descendants of a moved node are told too, but their own parent
+        // hasn't changed - and the moved node's hub mightn't be findable
+        // until it's been told itself.
+        if (parentHub == nullptr || parentHub->tree != tree.getParent())
+            setParentHub(getFor(tree.getParent()));
+
+        if (inheritedPropertyNames.empty())
+            return;
+
+        const std::vector<juce::Identifier> propertyNames(std::begin(inheritedPropertyNames),
+                                                          std::end(inheritedPropertyNames));
+        inheritanceRoots.clear();
+
+        for (const auto& propertyName : propertyNames)
+        {
+            if (tree.hasProperty(propertyName))
+                continue;
+
+            if (const auto entry = inheritedSubscribers.find(propertyName);
+                entry != std::end(inheritedSubscribers))
+            {
+                entry->second.call(&Subscriber::subscribedPropertyChanged,
+                                   tree,
+                                   propertyName);
+            }
+        }
+    }
+
+    void PropertyHub::valueTreeChildAdded(juce::ValueTree& parent, juce::ValueTree& child)
+    {
+        // The child's own hub, if it has one, fills in its slot once it's told
+        // about its new parent. Hubs created since the child was added are
+        // already the right size.
+        if (parent == tree && std::size(childHubs) < static_cast<std::size_t>(tree.getNumChildren()))
+        {
+            const auto index = juce::jlimit<std::size_t>(0,
+                                                         std::size(childHubs),
+                                                         static_cast<std::size_t>(tree.indexOf(child)));
+            childHubs.insert(std::begin(childHubs) + static_cast<std::ptrdiff_t>(index), nullptr);
+        }
+
+        for (auto& [propertyName, descendants] : descendantIndex)
+        {
+            std::vector<juce::ValueTree> addedDescendants;
+            collectTreesWithProperty(child, propertyName, addedDescendants);
+
+            if (addedDescendants.empty())
+                continue;
+
+            const auto position = std::lower_bound(std::begin(descendants),
+                                                   std::end(descendants),
+                                                   child,
+                                                   isBeforeInTree);
+            descendants.insert(position,
+                               std::begin(addedDescendants),
+                               std::end(addedDescendants));
+        }
+    }
+
+    void PropertyHub::valueTreeChildRemoved(juce::ValueTree& parent, juce::ValueTree& child, int index)
+    {
+        if (parent == tree
+            && std::size(childHubs) > static_cast<std::size_t>(tree.getNumChildren())
+            && juce::isPositiveAndBelow(index, std::size(childHubs)))
+        {
+            childHubs.erase(std::begin(childHubs) + index);
+        }
+
+        for (auto& [_, descendants] : descendantIndex)
+        {
+            descendants.erase(std::remove_if(std::begin(descendants),
+                                             std::end(descendants),
+                                             [&child](const auto& descendant) {
+                                                 return descendant == child || descendant.isAChildOf(child);
+                                             }),
+                              std::end(descendants));
+        }
+    }
+
+    void PropertyHub::valueTreeChildOrderChanged(juce::ValueTree& parent, int oldIndex, int newIndex)
+    {
+        // ValueTree::sort() reports a reorder from 0 to 0 once it's
+        // rearranged any number of children.
+        if (oldIndex == newIndex)
+        {
+            childrenSorted(parent);
+            return;
+        }
+
+        if (parent == tree
+            && juce::isPositiveAndBelow(oldIndex, std::size(childHubs))
+            && juce::isPositiveAndBelow(newIndex, std::size(childHubs)))
+        {
+            auto* movedHub = childHubs[static_cast<std::size_t>(oldIndex)];
+            childHubs.erase(std::begin(childHubs) + oldIndex);
+            childHubs.insert(std::begin(childHubs) + newIndex, movedHub);
+        }
+
+        const auto movedChild = parent.getChild(newIndex);
+
+        // Only the moved child's entries change places, and they only move
+        // past the entries of the siblings it moved past.
+        for (auto& [_, descendants] : descendantIndex)
+        {
+            const auto blockStart = std::find_if(std::begin(descendants),
+                                                 std::end(descendants),
+                                                 [&movedChild](const auto& descendant) {
+                                                     return isWithin(descendant, movedChild);
+                                                 });
+
+            if (blockStart == std::end(descendants))
+                continue;
+
+            const auto blockEnd = std::find_if_not(blockStart,
+                                                   std::end(descendants),
+                                                   [&movedChild](const auto& descendant) {
+                                                       return isWithin(descendant, movedChild);
+                                                   });
+
+            if (newIndex > oldIndex)
+            {
+                auto position = blockEnd;
+
+                for (auto index = oldIndex; index < newIndex; index++)
+                {
+                    const auto sibling = parent.getChild(index);
+
+                    while (position != std::end(descendants) && isWithin(*position, sibling))
+                        position++;
+                }
+
+                std::rotate(blockStart, blockEnd, position);
+            }
+            else
+            {
+                auto position = blockStart;
+
+                for (auto index = oldIndex; index > newIndex; index--)
+                {
+                    const auto sibling = parent.getChild(index);
+
+                    while (position != std::begin(descendants) && isWithin(*std::prev(position), sibling))
+                        position--;
+                }
+
+                std::rotate(position, blockStart, blockEnd);
+            }
+        }
+    }
+
+    void PropertyHub::childrenSorted(const juce::ValueTree& parent)
+    {
+        if (parent == tree && std::size(childHubs) == static_cast<std::size_t>(tree.getNumChildren()))
+        {
+            const auto previousChildHubs = childHubs;
+
+            for (auto index = 0; index < tree.getNumChildren(); index++)
+            {
+                const auto child = tree.getChild(index);
+                const auto childHub = std::find_if(std::begin(previousChildHubs),
+                                                   std::end(previousChildHubs),
+                                                   [&child](const auto* hub) {
+                                                       return hub != nullptr && hub->tree == child;
+                                                   });
+                childHubs[static_cast<std::size_t>(index)] = childHub != std::end(previousChildHubs)
+                                                               ? *childHub
+                                                               : nullptr;
+            }
+        }
+
+        // The entries under the parent stay together, so only they need
+        // sorting again.
+        for (auto& [_, descendants] : descendantIndex)
+        {
+            const auto first = std::find_if(std::begin(descendants),
+                                            std::end(descendants),
+                                            [&parent](const auto& descendant) {
+                                                return descendant.isAChildOf(parent);
+                                            });
+            const auto last = std::find_if_not(first,
+                                               std::end(descendants),
+                                               [&parent](const auto& descendant) {
+                                                   return descendant.isAChildOf(parent);
+                                               });
+            std::sort(first, last, isBeforeInTree);
+        }
+    }
+
+    PropertyHub::Subscribers& PropertyHub::getSubscribers(Scope scope) noexcept
+    {
+        switch (scope)
+        {
+        case Scope::node:
+            return nodeSubscribers;
+        case Scope::subtree:
+            return subtreeSubscribers;
+        case Scope::inherited:
+            return inheritedSubscribers;
+        }
+
+        jassertfalse;
+        return nodeSubscribers;
+    }
+
+    void PropertyHub::inheritedPropertyChanged(juce::ValueTree& treeWhosePropertyChanged,
+                                               const juce::Identifier& propertyName)
+    {
+        const ReferenceCountedPointer keepAlive{ this };
+        inheritanceRoots.erase(propertyName);
+
+        if (const auto entry = inheritedSubscribers.find(propertyName);
+            entry != std::end(inheritedSubscribers))
+        {
+            entry->second.call(&Subscriber::subscribedPropertyChanged,
+                               treeWhosePropertyChanged,
+                               propertyName);
+        }
+
+        const auto children = inheritingChildren[propertyName];
+
+        for (auto* child : children)
+        {
+            // Subscribers may have released the last reference to a child
+            // during one of the previous callbacks.
+            if (!inheritingChildren[propertyName].contains(child))
+                continue;
+
+            if (child->tree.hasProperty(propertyName))
+                continue;
+
+            child->inheritedPropertyChanged(treeWhosePropertyChanged, propertyName);
+        }
+    }
+
+    void PropertyHub::addInheritingChild(const juce::Identifier& propertyName, PropertyHub& child)
+    {
+        inheritingChildren[propertyName].addIfNotAlreadyThere(&child);
+        updateInheritanceLink(propertyName);
+    }
+
+    void PropertyHub::removeInheritingChild(const juce::Identifier& propertyName, PropertyHub& child)
+    {
+        inheritingChildren[propertyName].removeFirstMatchingValue(&child);
+        updateInheritanceLink(propertyName);
+    }
+
+    void PropertyHub::updateInheritanceLink(const juce::Identifier& propertyName)
+    {
+        const auto hasSubscribers = [this, &propertyName] {
+            const auto entry = inheritedSubscribers.find(propertyName);
+            return entry != std::end(inheritedSubscribers) && !entry->second.isEmpty();
+        }();
+        const auto hasChildren = !inheritingChildren[propertyName].isEmpty();
+        const auto isInherited = hasSubscribers || hasChildren;
+        const auto wasInherited = inheritedPropertyNames.count(propertyName) > 0;
+
+        if (isInherited == wasInherited)
+            return;
+
+        if (isInherited)
+        {
+            inheritedPropertyNames.insert(propertyName);
+
+            if (parentHub != nullptr)
+                parentHub->addInheritingChild(propertyName, *this);
+        }
+        else
+        {
+            inheritedPropertyNames.erase(propertyName);
+            inheritanceRoots.erase(propertyName);
+
+            if (parentHub != nullptr)
+                parentHub->removeInheritingChild(propertyName, *this);
+        }
+    }
+
+    void PropertyHub::updateDescendantIndex(const juce::ValueTree& descendant,
+                                            const juce::Identifier& propertyName)
+    {
+        const auto entry = descendantIndex.find(propertyName);
+
+        if (entry == std::end(descendantIndex))
+            return;
+
+        auto& descendants = entry->second;
+        const auto position = std::lower_bound(std::begin(descendants),
+                                               std::end(descendants),
+                                               descendant,
+                                               isBeforeInTree);
+        const auto isIndexed = position != std::end(descendants) && *position == descendant;
+
+        if (descendant.hasProperty(propertyName) && !isIndexed)
+            descendants.insert(position, descendant);
+        else if (!descendant.hasProperty(propertyName) && isIndexed)
+            descendants.erase(position);
+    }
+
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class PropertyHubUnitTest : public juce::UnitTest
+{
+public:
+    PropertyHubUnitTest()
+        : juce::UnitTest{ "jive::PropertyHub", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testSharing();
+        testManySiblings();
+        testNodeSubscriptions();
+        testSubtreeSubscriptions();
+        testInheritedSubscriptions();
+        testDescendantIndex();
+        testNativeState();
+        testTransitions();
+    }
+
+private:
+    struct Subscriber : public jive::PropertyHub::Subscriber
+    {
+        void subscribedPropertyChanged(juce::ValueTree& tree, const juce::Identifier& propertyName) final
+        {
+            lastTree = tree;
+            lastPropertyName = propertyName;
+            callbackCount++;
+        }
+
+        juce::ValueTree lastTree;
+        juce::Identifier lastPropertyName;
+        int callbackCount = 0;
+    };
+
+    void testSharing()
+    {
+        beginTest("sharing");
+
+        juce::ValueTree first{ "Component" };
+        juce::ValueTree second{ "Component" };
+        expect(jive::PropertyHub::getFor(juce::ValueTree{}) == nullptr);
+
+        const auto firstHub = jive::PropertyHub::getFor(first);
+        expect(firstHub != nullptr);
+        expect(jive::PropertyHub::getFor(first) == firstHub);
+        expect(jive::PropertyHub::getFor(juce::ValueTree{ first }) == firstHub);
+
+        const auto secondHub = jive::PropertyHub::getFor(second);
+        expect(secondHub != firstHub);
+        expect(secondHub->getTree() == second);
+    }
+
+    void testManySiblings()
+    {
+        beginTest("many siblings");
+
+        juce::ValueTree root{ "Component" };
+        static constexpr auto numChildren = 3000;
+
+        for (auto i = 0; i < numChildren; i++)
+            root.appendChild(juce::ValueTree{ "Component" }, nullptr);
+
+        std::vector<jive::PropertyHub::ReferenceCountedPointer> hubs;
+
+        for (auto i = 0; i < numChildren; i++)
+            hubs.push_back(jive::PropertyHub::getFor(root.getChild(i)));
+
+        auto allFound = true;
+
+        for (auto i = numChildren; --i >= 0;)
+            allFound = allFound && jive::PropertyHub::getFor(root.getChild(i)) == hubs[static_cast<std::size_t>(i)];
+
+        expect(allFound);
+
+        root.addChild(juce::ValueTree{ "Component" }, 0, nullptr);
+        root.moveChild(1, numChildren, nullptr);
+        expect(jive::PropertyHub::getFor(root.getChild(numChildren)) == hubs[0]);
+        expect(jive::PropertyHub::getFor(root.getChild(1)) == hubs[1]);
+        expect(jive::PropertyHub::getFor(root.getChild(0))->getTree() == root.getChild(0));
+
+        auto moved = root.getChild(2);
+        root.removeChild(moved, nullptr);
+        expect(jive::PropertyHub::getFor(moved) == hubs[2]);
+        root.getChild(0).appendChild(moved, nullptr);
+        expect(jive::PropertyHub::getFor(moved) == hubs[2]);
+        expect(jive::PropertyHub::getFor(root.getChild(2)) == hubs[3]);
+    }
+
+    void testNodeSubscriptions()
+    {
+        beginTest("node subscriptions");
+
+        juce::ValueTree tree{
+            "Component",
+            {},
+            {
+                juce::ValueTree{ "Component" },
+            },
+        };
+        const auto hub = jive::PropertyHub::getFor(tree);
+
+        Subscriber subscriber;
+        hub->subscribe("foo", subscriber);
+
+        tree.setProperty("bar", 123, nullptr);
+        expectEquals(subscriber.callbackCount, 0);
+
+        tree.setProperty("foo", 456, nullptr);
+        expectEquals(subscriber.callbackCount, 1);
+        expect(subscriber.lastTree == tree);
+        expect(subscriber.lastPropertyName == juce::Identifier{ "foo" });
+
+        tree.getChild(0).setProperty("foo", 789, nullptr);
+        expectEquals(subscriber.callbackCount, 1);
+
+        hub->unsubscribe("foo", subscriber);
+        tree.setProperty("foo", 101112, nullptr);
+        expectEquals(subscriber.callbackCount, 1);
+    }
+
+    void testSubtreeSubscriptions()
+    {
+        beginTest("subtree subscriptions");
+
+        juce::ValueTree tree{
+            "Component",
+            {},
+            {
+                juce::ValueTree{
+                    "Component",
+                    {},
+                    {
+                        juce::ValueTree{ "Component" },
+                    },
+                },
+            },
+        };
+        const auto hub = jive::PropertyHub::getFor(tree);
+
+        Subscriber subscriber;
+        hub->subscribe("foo", subscriber, jive::PropertyHub::Scope::subtree);
+
+        tree.setProperty("foo", 1, nullptr);
+        expectEquals(subscriber.callbackCount, 1);
+
+        tree.getChild(0).getChild(0).setProperty("foo", 2, nullptr);
+        expectEquals(subscriber.callbackCount, 2);
+        expect(subscriber.lastTree == tree.getChild(0).getChild(0));
+
+        tree.getChild(0).setProperty("bar", 3, nullptr);
+        expectEquals(subscriber.callbackCount, 2);
+
+        hub->unsubscribe("foo", subscriber, jive::PropertyHub::Scope::subtree);
+    }
+
+    void testInheritedSubscriptions()
+    {
+        beginTest("inherited subscriptions");
+
+        juce::ValueTree root{
+            "Component",
+            {
+                { "foo", 1 },
+            },
+            {
+                juce::ValueTree{
+                    "Component",
+                    {},
+                    {
+                        juce::ValueTree{ "Component" },
+                    },
+                },
+                juce::ValueTree{ "Component" },
+            },
+        };
+        auto parent = root.getChild(0);
+        auto child = parent.getChild(0);
+        auto sibling = root.getChild(1);
+        const auto hub = jive::PropertyHub::getFor(child);
+
+        Subscriber subscriber;
+        hub->subscribe("foo", subscriber, jive::PropertyHub::Scope::inherited);
+        expect(hub->findInheritanceRoot("foo") == root);
+        expect(hub->findInheritanceRoot("bar") == juce::ValueTree{});
+
+        root.setProperty("foo", 2, nullptr);
+        expectEquals(subscriber.callbackCount, 1);
+        expect(subscriber.lastTree == root);
+
+        sibling.setProperty("foo", 3, nullptr);
+        expectEquals(subscriber.callbackCount, 1);
+
+        parent.setProperty("foo", 4, nullptr);
+        expectEquals(subscriber.callbackCount, 2);
+        expect(hub->findInheritanceRoot("foo") == parent);
+
+        root.setProperty("foo", 5, nullptr);
+        expectEquals(subscriber.callbackCount, 2);
+
+        parent.removeProperty("foo", nullptr);
+        expectEquals(subscriber.callbackCount, 3);
+        expect(hub->findInheritanceRoot("foo") == root);
+
+        child.setProperty("foo", 6, nullptr);
+        expectEquals(subscriber.callbackCount, 4);
+        expect(hub->findInheritanceRoot("foo") == child);
+        child.removeProperty("foo", nullptr);
+        expectEquals(subscriber.callbackCount, 5);
+
+        sibling.setProperty("foo", 7, nullptr);
+        parent.removeChild(child, nullptr);
+        sibling.appendChild(child, nullptr);
+        expect(hub->findInheritanceRoot("foo") == sibling);
+
+        const auto callbackCount = subscriber.callbackCount;
+        sibling.setProperty("foo", 8, nullptr);
+        expectEquals(subscriber.callbackCount, callbackCount + 1);
+        parent.setProperty("foo", 9, nullptr);
+        expectEquals(subscriber.callbackCount, callbackCount + 1);
+
+        hub->unsubscribe("foo", subscriber, jive::PropertyHub::Scope::inherited);
+        root.setProperty("foo", 10, nullptr);
+        sibling.removeProperty("foo", nullptr);
+        expectEquals(subscriber.callbackCount, callbackCount + 1);
+    }
+
+    void testDescendantIndex()
+    {
+        beginTest("descendant index");
+
+        juce::ValueTree root{
+            "Component",
+            {
+                { "foo", 0 },
+            },
+            {
+                juce::ValueTree{
+                    "Component",
+                    {},
+                    {
+                        juce::ValueTree{ "Component", { { "foo", 1 } } },
+                    },
+                },
+                juce::ValueTree{ "Component", { { "foo", 2 } } },
+            },
+        };
+        const auto hub = jive::PropertyHub::getFor(root);
+
+        Subscriber subscriber;
+        hub->subscribe("foo", subscriber, jive::PropertyHub::Scope::subtree);
+
+        const auto& descendants = hub->getDescendantsWithProperty("foo");
+        expectEquals(static_cast<int>(std::size(descendants)), 2);
+        expect(descendants[0] == root.getChild(0).getChild(0));
+        expect(descendants[1] == root.getChild(1));
+        expect(hub->findFirstDescendantWithProperty("foo") == root.getChild(1));
+
+        root.getChild(0).setProperty("foo", 3, nullptr);
+        expectEquals(static_cast<int>(std::size(descendants)), 3);
+        expect(descendants[0] == root.getChild(0));
+        expect(hub->findFirstDescendantWithProperty("foo") == root.getChild(0));
+
+        root.getChild(1).removeProperty("foo", nullptr);
+        root.getChild(0).removeProperty("foo", nullptr);
+        expectEquals(static_cast<int>(std::size(descendants)), 1);
+        expect(hub->findFirstDescendantWithProperty("foo") == root.getChild(0).getChild(0));
+
+        root.appendChild(juce::ValueTree{
+                             "Component",
+                             {},
+                             {
+                                 juce::ValueTree{ "Component", { { "foo", 4 } } },
+                             },
+                         },
+                         nullptr);
+        expectEquals(static_cast<int>(std::size(descendants)), 2);
+        expect(descendants[1] == root.getChild(2).getChild(0));
+
+        root.moveChild(2, 0, nullptr);
+        expect(descendants[0] == root.getChild(0).getChild(0));
+        expect(descendants[1] == root.getChild(1).getChild(0));
+
+        root.removeChild(0, nullptr);
+        expectEquals(static_cast<int>(std::size(descendants)), 1);
+        expect(descendants[0] == root.getChild(0).getChild(0));
+
+        const auto getIndexedValues = [&descendants] {
+            juce::StringArray values;
+
+            for (const auto& descendant : descendants)
+                values.add(descendant["foo"].toString());
+
+            return values.joinIntoString(",");
+        };
+        juce::ValueTree list{ "Component" };
+
+        for (auto value = 10; value < 14; value++)
+            list.appendChild(juce::ValueTree{ "Component", { { "foo", value } } }, nullptr);
+
+        root.appendChild(list, nullptr);
+        expectEquals(getIndexedValues(), juce::String{ "1,10,11,12,13" });
+
+        list.moveChild(0, 2, nullptr);
+        expectEquals(getIndexedValues(), juce::String{ "1,11,12,10,13" });
+
+        list.moveChild(3, 0, nullptr);
+        expectEquals(getIndexedValues(), juce::String{ "1,13,11,12,10" });
+
+        list.getChild(2).removeProperty("foo", nullptr);
+        root.moveChild(2, 0, nullptr);
+        expectEquals(getIndexedValues(), juce::String{ "13,11,10,1" });
+
+        struct Comparator
+        {
+            static int compareElements(const juce::ValueTree& first, const juce::ValueTree& second)
+            {
+                return static_cast<int>(first["foo"]) - static_cast<int>(second["foo"]);
+            }
+        };
+        Comparator comparator;
+        list.sort(comparator, nullptr, true);
+        expectEquals(getIndexedValues(), juce::String{ "10,11,13,1" });
+
+        hub->unsubscribe("foo", subscriber, jive::PropertyHub::Scope::subtree);
+    }
+
+    void testNativeState()
+    {
+        beginTest("native state");
+
+        juce::ValueTree tree{ "Component" };
+        Subscriber subscriber;
+        jive::PropertyHub::getFor(tree)->subscribe("foo", subscriber);
+
+        auto state = jive::PropertyHub::getFor(tree)->getNativeState();
+        expect(state == jive::PropertyHub::getFor(tree)->getNativeState());
+        expect(state != jive::PropertyHub::getFor(juce::ValueTree{ "Component" })->getNativeState());
+
+        state->setProperty("foo", 123);
+        expectEquals(subscriber.callbackCount, 0);
+    #if !(JUCE_DEBUG && JIVE_MIRROR_NATIVE_STATE)
+        expect(!tree.hasProperty("foo"));
+    #endif
+
+        jive::PropertyHub::getFor(tree)->unsubscribe("foo", subscriber);
+        expect(jive::PropertyHub::getFor(tree)->getNativeState() == state);
+    }
+
+    void testTransitions()
+    {
+        beginTest("transitions");
+
+        juce::ValueTree tree{ "Component" };
+        const auto hub = jive::PropertyHub::getFor(tree);
+        Subscriber subscriber;
+        hub->subscribe("transition", subscriber);
+        expect(hub->getTransitions() == nullptr);
+
+        tree.setProperty("transition", "width 1s", nullptr);
+        const auto transitions = hub->getTransitions();
+        expect(transitions != nullptr);
+        expect((*transitions)["width"] != nullptr);
+        expect(dynamic_cast<jive::Transitions*>(tree["transition"].getObject()) == transitions.get());
+        expect(hub->getTransitions() == transitions);
+        expect(subscriber.lastTree == tree);
+
+        tree.setProperty("transition", "height 2s", nullptr);
+        expect(hub->getTransitions() != transitions);
+        expect((*hub->getTransitions())["height"] != nullptr);
+
+        tree.removeProperty("transition", nullptr);
+        expect(hub->getTransitions() == nullptr);
+
+        hub->unsubscribe("transition", subscriber);
+    }
+};
+
+static PropertyHubUnitTest propertyHubUnitTest;
+#endif
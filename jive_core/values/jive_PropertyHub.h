@@ -0,0 +1,168 @@
+#pragma once
+
+#include "jive_IdentifierHash.h"
+#include "jive_Object.h"
+
+#include <jive_core/kinetics/jive_Transitions.h>
+
+#include <juce_data_structures/juce_data_structures.h>
+
+namespace jive
+{
+    /** Forwards changes made to the properties of a single ValueTree node to
+        only those subscribers that are interested in the property that
+        changed.
+
+        Each node has at most one hub, shared by every Property that observes
+        it, so a node only ever has a single ValueTree::Listener registered on
+        behalf of any number of Properties.
+    */
+    class PropertyHub
+        : public juce::ReferenceCountedObject
+        , private juce::ValueTree::Listener
+    {
+    public:
+        using ReferenceCountedPointer = juce::ReferenceCountedObjectPtr<PropertyHub>;
+
+        struct Subscriber
+        {
+            virtual ~Subscriber() = default;
+
+            virtual void subscribedPropertyChanged(juce::ValueTree& treeWhosePropertyChanged,
+                                                   const juce::Identifier& propertyName) = 0;
+        };
+
+        enum class Scope
+        {
+            /** Changes made to the hub's own node. */
+            node,
+
+            /** Changes made to the hub's node or any of its descendants. */
+            subtree,
+
+            /** Changes to the value the hub's node would inherit, either by
+                the node itself or by an ancestor that isn't shadowed by a
+                closer node with the same property.
+            */
+            inherited,
+        };
+
+        ~PropertyHub() override;
+
+        void subscribe(const juce::Identifier& propertyName,
+                       Subscriber& subscriber,
+                       Scope scope = Scope::node);
+        void unsubscribe(const juce::Identifier& propertyName,
+                         Subscriber& subscriber,
+                         Scope scope = Scope::node);
+
+        [[nodiscard]] const juce::ValueTree& getTree() const noexcept;
+
+        /** Returns the closest of this hub's node and its ancestors that has
+            the given property, or an invalid tree if none of them do.
+
+            The result is remembered for as long as there are inherited-scope
+            subscribers for the property.
+        */
+        [[nodiscard]] juce::ValueTree findInheritanceRoot(const juce::Identifier& propertyName);
+
+        /** Returns the descendants of this hub's node that have the given
+            property, in depth-first order.
+
+            The list is built the first time it's asked for and then kept up to
+            date as descendants are added, removed and modified, until the
+            last subtree-scope subscriber for the property unsubscribes.
+        */
+        [[nodiscard]] const std::vector<juce::ValueTree>& getDescendantsWithProperty(const juce::Identifier& propertyName);
+
+        /** Returns the first descendant that has the given property, preferring
+            a node's direct children over any of their own descendants.
+        */
+        [[nodiscard]] juce::ValueTree findFirstDescendantWithProperty(const juce::Identifier& propertyName);
+
+        /** Returns an object for holding values that belong to this hub's node
+            but that shouldn't be written to the tree itself, such as those
+            derived while laying the node out. Changing them only notifies
+            Properties that use the object as their source.
+
+            The same object is returned for as long as anything refers to it.
+            Debug builds can define JIVE_MIRROR_NATIVE_STATE=1 to have its
+            properties copied into the tree so they can be inspected there.
+        */
+        [[nodiscard]] Object::ReferenceCountedPointer getNativeState();
+
+        /** Returns the transitions given by this hub's node, or nullptr if it
+            doesn't have any. Transitions given as a string are parsed, and the
+            result is stored back in the tree.
+
+            Whatever is found - including there being no transitions at all -
+            is remembered until the node's "transition" property changes.
+        */
+        [[nodiscard]] Transitions::ReferenceCountedPointer getTransitions();
+
+        /** Returns a number that changes whenever a font size given by a
+            node's style might have changed - when any node's "style" property
+            changes, when a node with a hub is moved, or when a "font-size" is
+            changed within any Object.
+
+            Values resolved against font sizes can be cached for as long as
+            this stays the same.
+        */
+        [[nodiscard]] static std::uint64_t getFontSizeGeneration() noexcept;
+
+        /** Marks any values resolved against font sizes as stale. */
+        static void fontSizesChanged() noexcept;
+
+        /** Returns the hub for the given tree, creating one if the tree doesn't
+            have one yet. Returns nullptr for invalid trees.
+        */
+        [[nodiscard]] static ReferenceCountedPointer getFor(const juce::ValueTree& tree);
+
+    private:
+        friend class PropertyHubRegistry;
+        class NativeState;
+
+        using Subscribers = std::unordered_map<juce::Identifier, juce::ListenerList<Subscriber>>;
+
+        explicit PropertyHub(const juce::ValueTree& tree);
+
+        void valueTreePropertyChanged(juce::ValueTree& treeWhosePropertyChanged,
+                                      const juce::Identifier& propertyName) final;
+        void valueTreeParentChanged(juce::ValueTree& treeWhoseParentChanged) final;
+        void valueTreeChildAdded(juce::ValueTree& parent, juce::ValueTree& child) final;
+        void valueTreeChildRemoved(juce::ValueTree& parent, juce::ValueTree& child, int index) final;
+        void valueTreeChildOrderChanged(juce::ValueTree& parent, int oldIndex, int newIndex) final;
+
+        [[nodiscard]] Subscribers& getSubscribers(Scope scope) noexcept;
+
+        void inheritedPropertyChanged(juce::ValueTree& treeWhosePropertyChanged,
+                                      const juce::Identifier& propertyName);
+        void addInheritingChild(const juce::Identifier& propertyName, PropertyHub& child);
+        void removeInheritingChild(const juce::Identifier& propertyName, PropertyHub& child);
+        void updateInheritanceLink(const juce::Identifier& propertyName);
+        void setParentHub(ReferenceCountedPointer newParentHub);
+
+        void childrenSorted(const juce::ValueTree& parent);
+        void updateDescendantIndex(const juce::ValueTree& descendant,
+                                   const juce::Identifier& propertyName);
+
+        juce::ValueTree tree;
+        Subscribers nodeSubscribers;
+        Subscribers subtreeSubscribers;
+        Subscribers inheritedSubscribers;
+
+        // Every hub keeps its parent node's hub alive, and each parent keeps
+        // track of its children's hubs by index so they can be found without
+        // searching.
+        ReferenceCountedPointer parentHub;
+        std::vector<PropertyHub*> childHubs;
+        std::unordered_set<juce::Identifier> inheritedPropertyNames;
+        std::unordered_map<juce::Identifier, juce::Array<PropertyHub*>> inheritingChildren;
+        std::unordered_map<juce::Identifier, juce::ValueTree> inheritanceRoots;
+        std::unordered_map<juce::Identifier, std::vector<juce::ValueTree>> descendantIndex;
+        NativeState* nativeState = nullptr;
+        std::optional<Transitions::ReferenceCountedPointer> transitions;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PropertyHub)
+    };
+} // namespace jive
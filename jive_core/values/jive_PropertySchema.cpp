@@ -0,0 +1,154 @@
+#include "jive_PropertySchema.h"
+
+#if JIVE_UNIT_TESTS
+class PropertySchemaUnitTest : public juce::UnitTest
+{
+public:
+    PropertySchemaUnitTest()
+        : juce::UnitTest{ "jive::PropertyTable", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testValues();
+        testDefaults();
+        testNotifications();
+        testObjectSources();
+    }
+
+private:
+    struct Schema
+    {
+        enum Slot
+        {
+            name,
+            enabled,
+            count,
+        };
+
+        static constexpr auto entries = std::make_tuple(
+            jive::PropertySchemaEntry<juce::String>{ "name" },
+            jive::PropertySchemaEntry<bool>{ "enabled", [] {
+                                                return true;
+                                            } },
+            jive::PropertySchemaEntry<int>{ "count" });
+    };
+
+    void testValues()
+    {
+        beginTest("values");
+
+        juce::ValueTree state{
+            "Component",
+            {
+                { "name", "Arthur Dent" },
+            },
+        };
+        jive::PropertyTable<Schema> table{ state };
+        expectEquals(table.get<Schema::name>(), juce::String{ "Arthur Dent" });
+        expect(table.exists<Schema::name>());
+        expect(!table.exists<Schema::count>());
+        expectEquals(table.get<Schema::count>(), 0);
+
+        table.set<Schema::count>(42);
+        expect(state["count"] == juce::var{ 42 });
+        expectEquals(table.get<Schema::count>(), 42);
+
+        state.setProperty("count",
+                          juce::var::NativeFunction{ [](const juce::var::NativeFunctionArgs&) {
+                              return 7;
+                          } },
+                          nullptr);
+        expectEquals(table.get<Schema::count>(), 7);
+        expect(jive::PropertyTable<Schema>::getIdentifier(Schema::enabled) == juce::Identifier{ "enabled" });
+    }
+
+    void testDefaults()
+    {
+        beginTest("defaults");
+
+        juce::ValueTree state{ "Component" };
+        jive::PropertyTable<Schema> table{ state };
+        table.applyDefaults();
+        expect(table.get<Schema::enabled>());
+        expect(!state.hasProperty("name"));
+        expect(!state.hasProperty("count"));
+
+        juce::ValueTree disabledState{
+            "Component",
+            {
+                { "enabled", false },
+            },
+        };
+        jive::PropertyTable<Schema> disabledTable{ disabledState };
+        disabledTable.applyDefaults();
+        expect(!disabledTable.get<Schema::enabled>());
+    }
+
+    void testNotifications()
+    {
+        beginTest("notifications");
+
+        juce::ValueTree state{
+            "Component",
+            {},
+            {
+                juce::ValueTree{ "Component" },
+            },
+        };
+        jive::PropertyTable<Schema> table{ state };
+        juce::Array<std::size_t> changedSlots;
+        table.onValueChange = [&changedSlots](std::size_t slot) {
+            changedSlots.add(slot);
+        };
+
+        state.setProperty("count", 1, nullptr);
+        state.setProperty("name", "Trillian", nullptr);
+        state.setProperty("unrelated", 2, nullptr);
+        state.getChild(0).setProperty("count", 3, nullptr);
+        state.removeProperty("name", nullptr);
+        expect(changedSlots == juce::Array<std::size_t>{ Schema::count, Schema::name });
+
+        changedSlots.clear();
+
+        {
+            jive::ScopedUpdateBatch batch{ state };
+            state.setProperty("enabled", false, nullptr);
+            state.setProperty("enabled", true, nullptr);
+            expect(changedSlots.isEmpty());
+        }
+
+        expect(changedSlots == juce::Array<std::size_t>{ Schema::enabled });
+    }
+
+    void testObjectSources()
+    {
+        beginTest("object sources");
+
+        jive::Object::ReferenceCountedPointer object = new jive::Object{
+            { "name", "Ford Prefect" },
+        };
+        jive::PropertyTable<Schema> table{ object };
+        juce::Array<std::size_t> changedSlots;
+        table.onValueChange = [&changedSlots](std::size_t slot) {
+            changedSlots.add(slot);
+        };
+        expectEquals(table.get<Schema::name>(), juce::String{ "Ford Prefect" });
+        expect(!table.exists<Schema::count>());
+
+        table.set<Schema::count>(3);
+        expect((*object)["count"] == juce::var{ 3 });
+        expectEquals(table.get<Schema::count>(), 3);
+
+        object->setProperty("unrelated", 4);
+        object->setProperty("nested", new jive::Object{ { "name", "Zaphod" } });
+        dynamic_cast<jive::Object*>(object->getProperty("nested").getObject())->setProperty("name", "Marvin");
+        table.clear<Schema::count>();
+        expect(!table.exists<Schema::count>());
+        expect(changedSlots == juce::Array<std::size_t>{ Schema::count });
+    }
+};
+
+static PropertySchemaUnitTest propertySchemaUnitTest;
+#endif
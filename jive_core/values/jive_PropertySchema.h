@@ -0,0 +1,241 @@
+#pragma once
+
+#include "jive_Object.h"
+#include "jive_PropertyHub.h"
+#include "jive_ScopedUpdateBatch.h"
+#include "variant-converters/jive_VariantConvertion.h"
+
+namespace jive
+{
+    /** Describes one of the properties in a PropertySchema - its name, the
+        type it's converted to, and optionally a function returning the value
+        it should take if the tree doesn't specify one.
+    */
+    template <typename ValueType>
+    struct PropertySchemaEntry
+    {
+        using Type = ValueType;
+
+        const char* name;
+        ValueType (*getDefault)() = nullptr;
+    };
+
+    /** Observes a fixed set of a ValueTree's properties, described at compile
+        time by a schema, in place of a separate Property for each one.
+
+        A schema is a type with a constexpr tuple of PropertySchemaEntry
+        objects named `entries`, along with an enum naming the index of each
+        entry:
+
+        @code
+        struct MySchema
+        {
+            enum Slot
+            {
+                name,
+                enabled,
+            };
+
+            static constexpr auto entries = std::make_tuple(
+                PropertySchemaEntry<juce::String>{ "name" },
+                PropertySchemaEntry<bool>{ "enabled", [] { return true; } });
+        };
+        @endcode
+
+        The properties can belong to either a ValueTree or an Object. Only the
+        source and a single callback are stored per table - the identifiers
+        are shared by every table using the same schema. Values are always
+        read straight from the source and aren't inherited,
+        accumulated or transitioned, so properties that need any of those
+        should still use a Property.
+    */
+    template <typename Schema>
+    class PropertyTable
+        : private PropertyHub::Subscriber
+        , private Object::Listener
+    {
+    public:
+        static constexpr auto numSlots = std::tuple_size_v<std::decay_t<decltype(Schema::entries)>>;
+
+        template <std::size_t slot>
+        using Type = typename std::tuple_element_t<slot, std::decay_t<decltype(Schema::entries)>>::Type;
+
+        explicit PropertyTable(const juce::ValueTree& sourceState)
+            : state{ sourceState }
+            , hub{ PropertyHub::getFor(state) }
+        {
+            if (hub != nullptr)
+            {
+                for (const auto& id : getIdentifiers())
+                    hub->subscribe(id, *this);
+            }
+        }
+
+        explicit PropertyTable(Object::ReferenceCountedPointer sourceObject)
+            : object{ std::move(sourceObject) }
+        {
+            if (object != nullptr)
+                object->addListener(*this);
+        }
+
+        ~PropertyTable() override
+        {
+            if (object != nullptr)
+            {
+                object->removeListener(*this);
+                return;
+            }
+
+            for (const auto& id : getIdentifiers())
+            {
+                ScopedUpdateBatch::cancel(this, id);
+
+                if (hub != nullptr)
+                    hub->unsubscribe(id, *this);
+            }
+        }
+
+        template <std::size_t slot>
+        [[nodiscard]] Type<slot> get() const
+        {
+            auto var = getVar(getIdentifier(slot));
+
+            if (var.isMethod())
+            {
+                juce::var::NativeFunctionArgs args{ var, nullptr, 0 };
+                var = var.getNativeFunction()(args);
+            }
+
+            return fromVar<Type<slot>>(var);
+        }
+
+        template <std::size_t slot>
+        void set(const Type<slot>& newValue)
+        {
+            if (object != nullptr)
+                object->setProperty(getIdentifier(slot), toVar(newValue));
+            else
+                state.setProperty(getIdentifier(slot), toVar(newValue), nullptr);
+        }
+
+        template <std::size_t slot>
+        void clear()
+        {
+            if (object != nullptr)
+                object->removeProperty(getIdentifier(slot));
+            else
+                state.removeProperty(getIdentifier(slot), nullptr);
+        }
+
+        template <std::size_t slot>
+        [[nodiscard]] bool exists() const
+        {
+            if (object != nullptr)
+                return object->hasProperty(getIdentifier(slot));
+
+            return state.hasProperty(getIdentifier(slot));
+        }
+
+        /** Gives each property that has a default its default value, unless
+            the tree already specifies one.
+        */
+        void applyDefaults()
+        {
+            applyDefaults(std::make_index_sequence<numSlots>{});
+        }
+
+        [[nodiscard]] static const juce::Identifier& getIdentifier(std::size_t slot)
+        {
+            return getIdentifiers()[slot];
+        }
+
+        /** Called with the slot of any property that changes. */
+        std::function<void(std::size_t)> onValueChange = nullptr;
+
+    private:
+        [[nodiscard]] static const std::array<juce::Identifier, numSlots>& getIdentifiers()
+        {
+            static const auto identifiers = std::apply(
+                [](const auto&... entry) {
+                    return std::array<juce::Identifier, numSlots>{ juce::Identifier{ entry.name }... };
+                },
+                Schema::entries);
+
+            return identifiers;
+        }
+
+        [[nodiscard]] juce::var getVar(const juce::Identifier& id) const
+        {
+            if (object != nullptr)
+                return (*object)[id];
+
+            return state[id];
+        }
+
+        [[nodiscard]] static std::size_t getSlot(const juce::Identifier& propertyName)
+        {
+            const auto& identifiers = getIdentifiers();
+            return static_cast<std::size_t>(std::distance(std::begin(identifiers),
+                                                          std::find(std::begin(identifiers),
+                                                                    std::end(identifiers),
+                                                                    propertyName)));
+        }
+
+        template <std::size_t... slots>
+        void applyDefaults(std::index_sequence<slots...>)
+        {
+            (applyDefault<slots>(), ...);
+        }
+
+        template <std::size_t slot>
+        void applyDefault()
+        {
+            if (const auto getDefault = std::get<slot>(Schema::entries).getDefault;
+                getDefault != nullptr && !exists<slot>())
+            {
+                set<slot>(getDefault());
+            }
+        }
+
+        void subscribedPropertyChanged(juce::ValueTree& treeWhosePropertyChanged,
+                                       const juce::Identifier& propertyName) final
+        {
+            if (!treeWhosePropertyChanged.hasProperty(propertyName))
+                return;
+
+            const auto slot = getSlot(propertyName);
+            jassert(slot < numSlots);
+
+            const auto notify = [this, slot] {
+                if (onValueChange != nullptr)
+                    onValueChange(slot);
+            };
+
+            if (!ScopedUpdateBatch::defer(state, this, propertyName, notify))
+                notify();
+        }
+
+        void propertyChanged(Object& objectWhosePropertyChanged,
+                             const juce::Identifier& propertyName) final
+        {
+            // Changes to objects nested within the source are passed on too.
+            if (&objectWhosePropertyChanged != object.get()
+                || !objectWhosePropertyChanged.hasProperty(propertyName))
+            {
+                return;
+            }
+
+            if (const auto slot = getSlot(propertyName);
+                slot < numSlots && onValueChange != nullptr)
+            {
+                onValueChange(slot);
+            }
+        }
+
+        juce::ValueTree state;
+        PropertyHub::ReferenceCountedPointer hub;
+        Object::ReferenceCountedPointer object;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PropertyTable)
+    };
+} // namespace jive
@@ -0,0 +1,272 @@
+#include "jive_RealtimeValue.h"
+
+#include <jive_core/time/jive_Timer.h>
+
+namespace jive
+{
+    struct RealtimeValueDispatcherState
+    {
+        juce::Array<RealtimeValueDispatcher::Client*> clients;
+        std::unique_ptr<Timer> timer;
+    };
+
+    static RealtimeValueDispatcherState& getDispatcherState()
+    {
+        static RealtimeValueDispatcherState state;
+        return state;
+    }
+
+    void RealtimeValueDispatcher::add(Client& client)
+    {
+        auto& state = getDispatcherState();
+        state.clients.addIfNotAlreadyThere(&client);
+
+        if (state.timer == nullptr)
+        {
+            state.timer = std::make_unique<Timer>(
+                [](juce::Time) {
+                    dispatchPendingValues();
+                },
+                frameInterval);
+        }
+        else
+        {
+            state.timer->start();
+        }
+    }
+
+    void RealtimeValueDispatcher::remove(Client& client)
+    {
+        auto& state = getDispatcherState();
+        state.clients.removeFirstMatchingValue(&client);
+
+        // The last client can be removed from within the timer's own
+        // callback, so the timer is only ever stopped, never deleted.
+        if (state.clients.isEmpty() && state.timer != nullptr)
+            state.timer->stop();
+    }
+
+    void RealtimeValueDispatcher::dispatchPendingValues()
+    {
+        auto& state = getDispatcherState();
+        juce::Array<Client*> pendingClients;
+
+        for (auto* client : state.clients)
+        {
+            if (client->hasPendingValue())
+                pendingClients.add(client);
+        }
+
+        if (pendingClients.isEmpty())
+            return;
+
+        std::vector<juce::ValueTree> batchedRoots;
+        std::vector<std::unique_ptr<ScopedUpdateBatch>> batches;
+
+        for (auto* client : pendingClients)
+        {
+            if (const auto root = client->getTreeToBatch().getRoot();
+                root.isValid()
+                && std::find(std::begin(batchedRoots), std::end(batchedRoots), root) == std::end(batchedRoots))
+            {
+                batchedRoots.push_back(root);
+                batches.push_back(std::make_unique<ScopedUpdateBatch>(root));
+            }
+        }
+
+        for (auto* client : pendingClients)
+        {
+            // Applying one value can cause another client to be removed.
+            if (state.clients.contains(client))
+                client->applyPendingValue();
+        }
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class RealtimeValueUnitTest : public juce::UnitTest
+{
+public:
+    RealtimeValueUnitTest()
+        : juce::UnitTest{ "jive::RealtimeValue", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testReadingAndWriting();
+        testBoundProperties();
+        testAudioRateWriting();
+        testUnbindingWhileApplying();
+    }
+
+private:
+    void testReadingAndWriting()
+    {
+        beginTest("reading and writing");
+
+        jive::RealtimeValue<float> value{ 0.5f };
+        expect(!value.read().has_value());
+
+        value.write(0.25f);
+        expect(value.read() == 0.25f);
+        expect(!value.read().has_value());
+
+        value.write(0.1f);
+        value.write(0.2f);
+        value.write(0.3f);
+        expect(value.read() == 0.3f);
+        expect(!value.read().has_value());
+    }
+
+    void testBoundProperties()
+    {
+        beginTest("bound properties");
+
+        juce::ValueTree root{
+            "Root",
+            {},
+            {
+                juce::ValueTree{ "Meter" },
+            },
+        };
+        auto meter = root.getChild(0);
+        jive::Property<float> level{ meter, "level" };
+        jive::Property<double> position{ meter, "position" };
+        auto numNotifications = 0;
+        level.onValueChange = [&numNotifications] {
+            numNotifications++;
+        };
+        position.onValueChange = [&numNotifications] {
+            numNotifications++;
+        };
+
+        jive::RealtimeValue<float> realtimeLevel;
+        realtimeLevel.bindTo(level, meter);
+        jive::RealtimeValue<double> realtimePosition;
+        realtimePosition.bindTo(position, meter);
+
+        realtimeLevel.write(0.1f);
+        realtimeLevel.write(0.7f);
+        realtimePosition.write(12.5);
+        expect(!meter.hasProperty("level"));
+
+        jive::FakeTime::incrementTime(jive::RealtimeValueDispatcher::frameInterval
+                                      + juce::RelativeTime::milliseconds(1));
+        expectEquals(level.get(), 0.7f);
+        expectEquals(position.get(), 12.5);
+        expectEquals(numNotifications, 2);
+
+        jive::FakeTime::incrementTime(jive::RealtimeValueDispatcher::frameInterval
+                                      + juce::RelativeTime::milliseconds(1));
+        expectEquals(numNotifications, 2);
+
+        realtimeLevel.unbind();
+        realtimeLevel.write(0.9f);
+        jive::RealtimeValueDispatcher::dispatchPendingValues();
+        expectEquals(level.get(), 0.7f);
+    }
+
+    void testAudioRateWriting()
+    {
+        beginTest("audio-rate writing");
+
+        juce::ValueTree state{ "Meter" };
+        jive::Property<int> sampleIndex{ state, "sample-index" };
+        juce::Array<int> notifiedValues;
+        sampleIndex.onValueChange = [&] {
+            notifiedValues.add(sampleIndex.get());
+        };
+
+        jive::RealtimeValue<int> realtimeSampleIndex;
+        realtimeSampleIndex.bindTo(sampleIndex, state);
+
+        static constexpr auto sampleRate = 48000;
+        static constexpr auto numSamples = sampleRate / 4;
+        std::atomic<bool> finished{ false };
+
+        std::thread audioThread{
+            [&] {
+                const auto start = juce::Time::getHighResolutionTicks();
+                const auto ticksPerSample = juce::Time::getHighResolutionTicksPerSecond() / sampleRate;
+
+                for (auto i = 1; i <= numSamples; i++)
+                {
+                    while (juce::Time::getHighResolutionTicks() - start < i * ticksPerSample)
+                    {
+                    }
+
+                    realtimeSampleIndex.write(i);
+                }
+
+                finished = true;
+            },
+        };
+
+        auto numFrames = 0;
+
+        while (!finished)
+        {
+            jive::RealtimeValueDispatcher::dispatchPendingValues();
+            numFrames++;
+            juce::Thread::sleep(static_cast<int>(jive::RealtimeValueDispatcher::frameInterval.inMilliseconds()));
+        }
+
+        audioThread.join();
+        jive::RealtimeValueDispatcher::dispatchPendingValues();
+
+        expectEquals(sampleIndex.get(), numSamples);
+        expectLessOrEqual(notifiedValues.size(), numFrames + 1);
+        expectGreaterThan(notifiedValues.size(), 0);
+
+        for (auto i = 1; i < notifiedValues.size(); i++)
+            expectGreaterThan(notifiedValues[i], notifiedValues[i - 1]);
+    }
+
+    void testUnbindingWhileApplying()
+    {
+        beginTest("unbinding while applying");
+
+        juce::ValueTree state{ "Meter" };
+        jive::Property<float> level{ state, "level" };
+
+        auto realtimeLevel = std::make_unique<jive::RealtimeValue<float>>();
+        realtimeLevel->bind(
+            [&](float value) {
+                level = value;
+                realtimeLevel->unbind();
+            },
+            state);
+        realtimeLevel->write(0.5f);
+        jive::FakeTime::incrementTime(jive::RealtimeValueDispatcher::frameInterval
+                                      + juce::RelativeTime::milliseconds(1));
+        expectEquals(level.get(), 0.5f);
+
+        realtimeLevel->write(0.25f);
+        jive::FakeTime::incrementTime(jive::RealtimeValueDispatcher::frameInterval
+                                      + juce::RelativeTime::milliseconds(1));
+        expectEquals(level.get(), 0.5f);
+
+        realtimeLevel->bind(
+            [&](float value) {
+                level = value;
+                realtimeLevel = nullptr;
+            },
+            state);
+        realtimeLevel->write(0.75f);
+        jive::FakeTime::incrementTime(jive::RealtimeValueDispatcher::frameInterval
+                                      + juce::RelativeTime::milliseconds(1));
+        expectEquals(level.get(), 0.75f);
+        expect(realtimeLevel == nullptr);
+
+        jive::RealtimeValue<float> otherLevel;
+        otherLevel.bindTo(level, state);
+        otherLevel.write(1.0f);
+        jive::FakeTime::incrementTime(jive::RealtimeValueDispatcher::frameInterval
+                                      + juce::RelativeTime::milliseconds(1));
+        expectEquals(level.get(), 1.0f);
+    }
+};
+
+static RealtimeValueUnitTest realtimeValueUnitTest;
+#endif
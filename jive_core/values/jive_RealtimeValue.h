@@ -0,0 +1,174 @@
+#pragma once
+
+#include "jive_Property.h"
+
+#include <juce_data_structures/juce_data_structures.h>
+
+namespace jive
+{
+    /** Applies the values written to each bound RealtimeValue once per frame,
+        on the message thread.
+
+        Every tree that's about to be changed is covered by a ScopedUpdateBatch
+        while the values are applied, so each Property is notified at most
+        once per frame however many values were written in between.
+    */
+    class RealtimeValueDispatcher
+    {
+    public:
+        struct Client
+        {
+            virtual ~Client() = default;
+
+            [[nodiscard]] virtual bool hasPendingValue() const noexcept = 0;
+            [[nodiscard]] virtual juce::ValueTree getTreeToBatch() const = 0;
+            virtual void applyPendingValue() = 0;
+        };
+
+        /** Must be called from the message thread. */
+        static void add(Client& client);
+
+        /** Must be called from the message thread. */
+        static void remove(Client& client);
+
+        /** Applies any pending values straight away, rather than waiting for
+            the next frame. Must be called from the message thread.
+        */
+        static void dispatchPendingValues();
+
+        static inline const auto frameInterval = juce::RelativeTime::milliseconds(16);
+    };
+
+    /** Carries a value from a single realtime thread, such as the audio
+        thread, to the message thread.
+
+        Writing never blocks, allocates or waits on the reader: the value is
+        copied into one of three slots, and the slots are swapped with a single
+        atomic exchange. Only the most recent value is kept, so a reader that
+        falls behind simply skips the values in between.
+    */
+    template <typename ValueType>
+    class RealtimeValue : private RealtimeValueDispatcher::Client
+    {
+    public:
+        static_assert(std::is_trivially_copyable<ValueType>(),
+                      "Values must be copied without allocating or locking");
+
+        RealtimeValue()
+            : RealtimeValue{ ValueType{} }
+        {
+        }
+
+        explicit RealtimeValue(const ValueType& initialValue)
+        {
+            slots.fill(initialValue);
+        }
+
+        ~RealtimeValue() override
+        {
+            unbind();
+        }
+
+        /** Publishes a new value. Wait-free, so safe to call from the audio
+            thread, but must only ever be called from one thread at a time.
+        */
+        void write(const ValueType& newValue) noexcept
+        {
+            slots[writeSlot] = newValue;
+            const auto previous = sharedSlot.exchange(static_cast<std::uint8_t>(writeSlot | freshFlag),
+                                                      std::memory_order_acq_rel);
+            writeSlot = static_cast<std::uint8_t>(previous & slotMask);
+        }
+
+        /** Returns the most recently written value, or std::nullopt if nothing
+            has been written since it was last read. Wait-free, but must only
+            ever be called from one thread at a time.
+        */
+        [[nodiscard]] std::optional<ValueType> read() noexcept
+        {
+            if ((sharedSlot.load(std::memory_order_relaxed) & freshFlag) == 0)
+                return std::nullopt;
+
+            const auto previous = sharedSlot.exchange(static_cast<std::uint8_t>(readSlot),
+                                                      std::memory_order_acq_rel);
+            readSlot = static_cast<std::uint8_t>(previous & slotMask);
+
+            return slots[readSlot];
+        }
+
+        /** Calls the given function on the message thread, once per frame,
+            with the latest value, whenever a new value has been written.
+
+            Notifications for the given tree are batched while the value is
+            applied.
+        */
+        void bind(std::function<void(const ValueType&)> applyValue,
+                  const juce::ValueTree& treeToBatch = {})
+        {
+            unbind();
+
+            apply = std::move(applyValue);
+            batchedTree = treeToBatch;
+
+            if (apply != nullptr)
+                RealtimeValueDispatcher::add(*this);
+        }
+
+        /** Sets the given Property to the latest value once per frame. The
+            property must outlive this object, or be unbound first.
+        */
+        template <Inheritance inheritance, Accumulation accumulation, bool autoParseStrings, Responsiveness responsiveness>
+        void bindTo(Property<ValueType, inheritance, accumulation, autoParseStrings, responsiveness>& property,
+                    const juce::ValueTree& propertyTree)
+        {
+            bind(
+                [&property](const ValueType& value) {
+                    property = value;
+                },
+                propertyTree);
+        }
+
+        void unbind()
+        {
+            if (apply != nullptr)
+                RealtimeValueDispatcher::remove(*this);
+
+            apply = nullptr;
+            batchedTree = juce::ValueTree{};
+        }
+
+    private:
+        static constexpr std::uint8_t slotMask = 0b011;
+        static constexpr std::uint8_t freshFlag = 0b100;
+
+        bool hasPendingValue() const noexcept final
+        {
+            return (sharedSlot.load(std::memory_order_relaxed) & freshFlag) != 0;
+        }
+
+        juce::ValueTree getTreeToBatch() const final
+        {
+            return batchedTree;
+        }
+
+        void applyPendingValue() final
+        {
+            if (const auto value = read(); value.has_value() && apply != nullptr)
+            {
+                // The callback may unbind, or even delete, this value.
+                const auto applyValue = apply;
+                applyValue(*value);
+            }
+        }
+
+        std::array<ValueType, 3> slots;
+        std::atomic<std::uint8_t> sharedSlot{ 1 };
+        std::uint8_t writeSlot = 0;
+        std::uint8_t readSlot = 2;
+
+        std::function<void(const ValueType&)> apply;
+        juce::ValueTree batchedTree;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RealtimeValue)
+    };
+} // namespace jive
@@ -0,0 +1,265 @@
+#include "jive_ScopedUpdateBatch.h"
+
+namespace jive
+{
+    [[nodiscard]] static std::vector<ScopedUpdateBatch*>& getActiveUpdateBatches()
+    {
+        static std::vector<ScopedUpdateBatch*> batches;
+        return batches;
+    }
+
+    ScopedUpdateBatch::ScopedUpdateBatch(const juce::ValueTree& batchRoot)
+        : root{ batchRoot }
+    {
+        getActiveUpdateBatches().push_back(this);
+    }
+
+    ScopedUpdateBatch::~ScopedUpdateBatch()
+    {
+        commit();
+
+        auto& batches = getActiveUpdateBatches();
+        batches.erase(std::remove(std::begin(batches), std::end(batches), this),
+                      std::end(batches));
+    }
+
+    bool ScopedUpdateBatch::defer(const juce::ValueTree& tree,
+                                  const void* owner,
+                                  const juce::Identifier& action,
+                                  std::function<void()> callback,
+                                  Phase phase)
+    {
+        // Batches are stored outermost-first, so an update is always queued
+        // on the batch that will be the last to commit.
+        for (auto* batch : getActiveUpdateBatches())
+        {
+            if (!batch->isDeferring)
+                continue;
+
+            if (tree == batch->root || tree.isAChildOf(batch->root))
+            {
+                batch->queue(owner, action, std::move(callback), phase);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void ScopedUpdateBatch::cancel(const void* owner, const juce::Identifier& action)
+    {
+        for (auto* batch : getActiveUpdateBatches())
+        {
+            if (const auto pending = batch->pendingUpdates.find({ owner, action });
+                pending != std::end(batch->pendingUpdates))
+            {
+                pending->second->callback = nullptr;
+                batch->pendingUpdates.erase(pending);
+            }
+        }
+    }
+
+    std::size_t ScopedUpdateBatch::UpdateKeyHash::operator()(const std::pair<const void*, juce::Identifier>& key) const
+    {
+        return std::hash<const void*>{}(key.first) ^ (std::hash<juce::Identifier>{}(key.second) << 1);
+    }
+
+    void ScopedUpdateBatch::queue(const void* owner,
+                                  const juce::Identifier& action,
+                                  std::function<void()> callback,
+                                  Phase phase)
+    {
+        if (const auto pending = pendingUpdates.find({ owner, action });
+            pending != std::end(pendingUpdates))
+        {
+            pending->second->callback = std::move(callback);
+            return;
+        }
+
+        auto& queuedUpdates = updates[static_cast<std::size_t>(phase)];
+        queuedUpdates.push_back({ owner, action, std::move(callback) });
+        pendingUpdates[{ owner, action }] = &queuedUpdates.back();
+    }
+
+    void ScopedUpdateBatch::commit()
+    {
+        // Property callbacks often change other properties, which are queued
+        // on the end of this same batch and so are still only dispatched once.
+        for (auto& propertyChanges = updates[static_cast<std::size_t>(Phase::propertyChanges)];
+             !propertyChanges.empty();)
+        {
+            auto update = std::move(propertyChanges.front());
+            pendingUpdates.erase({ update.owner, update.action });
+            propertyChanges.pop_front();
+
+            if (update.callback != nullptr)
+                update.callback();
+        }
+
+        // Laying out relies on the changes it makes being observed straight
+        // away, so nothing is deferred from here on.
+        isDeferring = false;
+        const auto layouts = std::move(updates[static_cast<std::size_t>(Phase::layout)]);
+        updates[static_cast<std::size_t>(Phase::layout)].clear();
+        pendingUpdates.clear();
+
+        for (const auto& update : layouts)
+        {
+            if (update.callback != nullptr)
+                update.callback();
+        }
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class ScopedUpdateBatchUnitTest : public juce::UnitTest
+{
+public:
+    ScopedUpdateBatchUnitTest()
+        : juce::UnitTest{ "jive::ScopedUpdateBatch", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testDeferral();
+        testPhases();
+        testNesting();
+        testPropertyNotifications();
+    }
+
+private:
+    void testDeferral()
+    {
+        beginTest("deferral");
+
+        juce::ValueTree root{
+            "Component",
+            {},
+            {
+                juce::ValueTree{ "Component" },
+            },
+        };
+        juce::ValueTree unrelated{ "Component" };
+        auto numCalls = 0;
+        const auto callback = [&numCalls] {
+            numCalls++;
+        };
+
+        expect(!jive::ScopedUpdateBatch::defer(root, this, "foo", callback));
+
+        {
+            jive::ScopedUpdateBatch batch{ root };
+            expect(jive::ScopedUpdateBatch::defer(root, this, "foo", callback));
+            expect(jive::ScopedUpdateBatch::defer(root.getChild(0), this, "foo", callback));
+            expect(jive::ScopedUpdateBatch::defer(root, this, "bar", callback));
+            expect(!jive::ScopedUpdateBatch::defer(unrelated, this, "foo", callback));
+
+            expect(jive::ScopedUpdateBatch::defer(root, &numCalls, "foo", callback));
+            jive::ScopedUpdateBatch::cancel(&numCalls, "foo");
+
+            expectEquals(numCalls, 0);
+        }
+
+        expectEquals(numCalls, 2);
+    }
+
+    void testPhases()
+    {
+        beginTest("phases");
+
+        juce::ValueTree root{ "Component" };
+        juce::StringArray calls;
+
+        {
+            jive::ScopedUpdateBatch batch{ root };
+            jive::ScopedUpdateBatch::defer(
+                root,
+                this,
+                "layout",
+                [&calls, &root] {
+                    calls.add("layout");
+
+                    const auto wasDeferred = jive::ScopedUpdateBatch::defer(root, &calls, "late", [&calls] {
+                        calls.add("late");
+                    });
+                    jassertquiet(!wasDeferred);
+                },
+                jive::ScopedUpdateBatch::Phase::layout);
+            jive::ScopedUpdateBatch::defer(root, this, "first", [&calls, &root] {
+                calls.add("first");
+                jive::ScopedUpdateBatch::defer(root, &calls, "second", [&calls] {
+                    calls.add("second");
+                });
+            });
+        }
+
+        expect(calls == juce::StringArray{ "first", "second", "layout" });
+    }
+
+    void testNesting()
+    {
+        beginTest("nesting");
+
+        juce::ValueTree root{
+            "Component",
+            {},
+            {
+                juce::ValueTree{ "Component" },
+            },
+        };
+        auto numCalls = 0;
+
+        {
+            jive::ScopedUpdateBatch outer{ root };
+
+            {
+                jive::ScopedUpdateBatch inner{ root.getChild(0) };
+                jive::ScopedUpdateBatch::defer(root.getChild(0), this, "foo", [&numCalls] {
+                    numCalls++;
+                });
+            }
+
+            expectEquals(numCalls, 0);
+        }
+
+        expectEquals(numCalls, 1);
+    }
+
+    void testPropertyNotifications()
+    {
+        beginTest("property notifications");
+
+        juce::ValueTree root{ "Component" };
+        jive::Property<int> value{ root, "value" };
+        auto numCalls = 0;
+        value.onValueChange = [&numCalls] {
+            numCalls++;
+        };
+
+        {
+            jive::ScopedUpdateBatch batch{ root };
+            value = 1;
+            value = 2;
+            root.setProperty("value", 3, nullptr);
+            expectEquals(value.get(), 3);
+            expectEquals(numCalls, 0);
+        }
+
+        expectEquals(numCalls, 1);
+
+        {
+            jive::ScopedUpdateBatch batch{ root };
+            jive::Property<int> temporary{ root, "value" };
+            temporary.onValueChange = [this] {
+                expect(false);
+            };
+            temporary = 4;
+        }
+
+        expectEquals(numCalls, 2);
+    }
+};
+
+static ScopedUpdateBatchUnitTest scopedUpdateBatchUnitTest;
+#endif
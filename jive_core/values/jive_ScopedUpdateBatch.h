@@ -0,0 +1,74 @@
+#pragma once
+
+#include "jive_IdentifierHash.h"
+
+#include <juce_data_structures/juce_data_structures.h>
+
+namespace jive
+{
+    /** Collects the change notifications of every Property within a subtree,
+        and any layout they would trigger, until the batch goes out of scope.
+
+        When the batch is destroyed, each Property that changed is notified
+        once, regardless of how many times its value changed, after which
+        each item that requested a layout is laid out once.
+
+        Batches can be nested, in which case everything is deferred until the
+        outermost batch covering the changed tree is destroyed.
+    */
+    class ScopedUpdateBatch
+    {
+    public:
+        enum class Phase
+        {
+            propertyChanges,
+            layout,
+        };
+
+        explicit ScopedUpdateBatch(const juce::ValueTree& root);
+        ~ScopedUpdateBatch();
+
+        /** If the given tree is covered by an active batch, queues the callback
+            to be called when that batch commits and returns true. Otherwise
+            returns false, in which case the caller should carry on as normal.
+
+            Callbacks are identified by their owner and action - deferring the
+            same action for the same owner more than once only calls the most
+            recent callback.
+        */
+        static bool defer(const juce::ValueTree& tree,
+                          const void* owner,
+                          const juce::Identifier& action,
+                          std::function<void()> callback,
+                          Phase phase = Phase::propertyChanges);
+
+        /** Discards any callback queued for the given owner and action. */
+        static void cancel(const void* owner, const juce::Identifier& action);
+
+    private:
+        struct Update
+        {
+            const void* owner;
+            juce::Identifier action;
+            std::function<void()> callback;
+        };
+
+        struct UpdateKeyHash
+        {
+            std::size_t operator()(const std::pair<const void*, juce::Identifier>& key) const;
+        };
+
+        void queue(const void* owner,
+                   const juce::Identifier& action,
+                   std::function<void()> callback,
+                   Phase phase);
+        void commit();
+
+        juce::ValueTree root;
+        std::array<std::deque<Update>, 2> updates;
+        std::unordered_map<std::pair<const void*, juce::Identifier>, Update*, UpdateKeyHash> pendingUpdates;
+        bool isDeferring = true;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ScopedUpdateBatch)
+    };
+} // namespace jive
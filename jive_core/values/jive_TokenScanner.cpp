@@ -0,0 +1,193 @@
+#include "jive_TokenScanner.h"
+
+#if JIVE_UNIT_TESTS
+    #include <jive_core/geometry/jive_BorderRadii.h>
+    #include <jive_core/logging/jive_StringStreams.h>
+    #include <jive_core/time/jive_TimeParser.h>
+    #include <jive_core/values/variant-converters/jive_MiscVariantConverters.h>
+
+    #include <regex>
+
+class TokenScannerUnitTest : public juce::UnitTest
+{
+public:
+    TokenScannerUnitTest()
+        : juce::UnitTest{ "jive::TokenScanner", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testTokens();
+        testFuzzedTokens();
+        testFuzzedConverters();
+        testFuzzedTimes();
+    }
+
+private:
+    void testTokens()
+    {
+        beginTest("tokens");
+
+        const juce::String text{ "10 20  3.5px" };
+        jive::TokenScanner scanner{ text, " " };
+        expect(scanner.moveToNextToken());
+        expectEquals(scanner.getIntValue(), 10);
+        expect(scanner.moveToNextToken());
+        expectEquals(scanner.getDoubleValue(), 20.0);
+        expect(scanner.moveToNextToken());
+        expect(scanner.isTokenEmpty());
+        expectEquals(scanner.getIntValue(), 0);
+        expect(scanner.moveToNextToken());
+        expectEquals(scanner.getDoubleValue(), 3.5);
+        expect(!scanner.moveToNextToken());
+
+        expectEquals(jive::TokenScanner::countTokens("", ","), 0);
+        expectEquals(jive::TokenScanner::countTokens(",", ","), 2);
+        expectEquals(jive::TokenScanner::countTokens("1,2,3", ","), 3);
+    }
+
+    void testFuzzedTokens()
+    {
+        beginTest("fuzzed tokens");
+
+        juce::Random random{ 5678 };
+
+        for (auto i = 0; i < 5000; i++)
+        {
+            const auto text = generateNumbers(random, " ,\t");
+            const auto tokens = juce::StringArray::fromTokens(text, ", ", "");
+            jive::TokenScanner scanner{ text, ", " };
+
+            for (const auto& token : tokens)
+            {
+                expect(scanner.moveToNextToken());
+                expectEquals(scanner.getIntValue(), token.getIntValue(), text);
+                expectEquals(scanner.getDoubleValue(), token.getDoubleValue(), text);
+            }
+
+            expect(!scanner.moveToNextToken());
+            expectEquals(jive::TokenScanner::countTokens(text, ", "), tokens.size());
+        }
+    }
+
+    void testFuzzedConverters()
+    {
+        beginTest("fuzzed converters");
+
+        juce::Random random{ 9012 };
+
+        for (auto i = 0; i < 5000; i++)
+        {
+            const auto borderText = generateNumbers(random, " \t");
+            const auto border = juce::VariantConverter<juce::BorderSize<float>>::fromVar(borderText);
+            expect(border == parseBorderSizeWithStringArrays(borderText), borderText);
+
+            const auto radiiText = generateNumbers(random, " ");
+            const auto radii = juce::VariantConverter<jive::BorderRadii<float>>::fromVar(radiiText);
+            expect(radii == parseBorderRadiiWithStringArrays(radiiText), radiiText);
+
+            const auto pointText = generateNumbers(random, " ", 1) + "," + generateNumbers(random, " ", 1);
+            const auto tokens = juce::StringArray::fromTokens(pointText, ",", "");
+            const auto point = juce::VariantConverter<juce::Point<float>>::fromVar(pointText);
+            expectEquals(point.x, static_cast<float>(tokens[0].getDoubleValue()), pointText);
+            expectEquals(point.y, static_cast<float>(tokens[1].getDoubleValue()), pointText);
+        }
+    }
+
+    void testFuzzedTimes()
+    {
+        beginTest("fuzzed times");
+
+        juce::Random random{ 3456 };
+        static constexpr auto timeCharacters = "0123456789..sm -";
+
+        for (auto i = 0; i < 5000; i++)
+        {
+            juce::String text;
+            const auto length = random.nextInt(8);
+
+            for (auto character = 0; character < length; character++)
+                text << juce::String::charToString(timeCharacters[random.nextInt(static_cast<int>(std::strlen(timeCharacters)))]);
+
+            if (random.nextBool())
+                text << juce::String{ random.nextInt(5000) } << (random.nextBool() ? "ms" : "s");
+
+            static const std::regex timeDataTypeRegex{ R"(^(\d+(\.\d+)?)(s|ms)$)" };
+            expectEquals(jive::isValidTimeString(text),
+                         std::regex_match(text.toRawUTF8(), timeDataTypeRegex),
+                         text);
+        }
+
+        expect(jive::parseTime("1.5s") == juce::RelativeTime::seconds(1.5));
+        expect(jive::parseTime("250ms") == juce::RelativeTime::milliseconds(250));
+        expect(!jive::parseTime("1.s").has_value());
+        expect(!jive::parseTime("ms").has_value());
+        expect(!jive::parseTime("10mss").has_value());
+    }
+
+    [[nodiscard]] static juce::String generateNumbers(juce::Random& random,
+                                                      const char* separators,
+                                                      int maxNumNumbers = 5)
+    {
+        juce::String text;
+        const auto numNumbers = random.nextInt(maxNumNumbers + 1);
+
+        for (auto i = 0; i < numNumbers; i++)
+        {
+            const auto numSeparators = i == 0 ? random.nextInt(2) : 1 + random.nextInt(2);
+
+            for (auto separator = 0; separator < numSeparators; separator++)
+                text << juce::String::charToString(separators[random.nextInt(static_cast<int>(std::strlen(separators)))]);
+
+            if (random.nextInt(8) == 0)
+                text << "-";
+
+            text << random.nextInt(1000);
+
+            if (random.nextBool())
+                text << "." << random.nextInt(100);
+            if (random.nextInt(4) == 0)
+                text << "px";
+        }
+
+        return text;
+    }
+
+    // The implementations the converters replaced, which their results must
+    // continue to match.
+    [[nodiscard]] static juce::BorderSize<float> parseBorderSizeWithStringArrays(const juce::String& text)
+    {
+        const auto tokens = juce::StringArray::fromTokens(text, false);
+
+        if (tokens.size() == 1)
+            return juce::BorderSize<float>{ static_cast<float>(juce::var{ text }) };
+        if (tokens.size() == 2)
+            return { tokens[0].getFloatValue(), tokens[1].getFloatValue(), tokens[0].getFloatValue(), tokens[1].getFloatValue() };
+        if (tokens.size() == 3)
+            return { tokens[0].getFloatValue(), tokens[1].getFloatValue(), tokens[2].getFloatValue(), tokens[1].getFloatValue() };
+        if (tokens.size() == 4)
+            return { tokens[0].getFloatValue(), tokens[3].getFloatValue(), tokens[2].getFloatValue(), tokens[1].getFloatValue() };
+
+        return {};
+    }
+
+    [[nodiscard]] static jive::BorderRadii<float> parseBorderRadiiWithStringArrays(const juce::String& text)
+    {
+        const auto tokens = juce::StringArray::fromTokens(text, " ", "");
+
+        if (tokens.size() == 1)
+            return { tokens[0].getFloatValue() };
+        if (tokens.size() == 2)
+            return { tokens[0].getFloatValue(), tokens[1].getFloatValue() };
+        if (tokens.size() == 3)
+            return { tokens[0].getFloatValue(), tokens[1].getFloatValue(), tokens[2].getFloatValue() };
+        if (tokens.size() >= 4)
+            return { tokens[0].getFloatValue(), tokens[1].getFloatValue(), tokens[2].getFloatValue(), tokens[3].getFloatValue() };
+
+        return {};
+    }
+};
+
+static TokenScannerUnitTest tokenScannerUnitTest;
+#endif
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+namespace jive
+{
+    /** Steps through the tokens of a string in place, without copying any of
+        them into new strings.
+
+        The string is split exactly as juce::StringArray::fromTokens() would
+        split it, including the empty tokens between adjacent break characters,
+        and tokens are converted to numbers the same way juce::String does, so
+        parsers written against StringArray can switch over without changing
+        their results.
+    */
+    class TokenScanner
+    {
+    public:
+        TokenScanner(juce::CharPointer_UTF8 textStart,
+                     juce::CharPointer_UTF8 textEnd,
+                     const char* breakCharacters) noexcept
+            : next{ textStart }
+            , end{ textEnd }
+            , tokenStart{ textStart }
+            , tokenEnd{ textStart }
+            , breaks{ breakCharacters }
+            , finished{ textStart == textEnd }
+        {
+        }
+
+        TokenScanner(const juce::String& text, const char* breakCharacters) noexcept
+            : TokenScanner{ text.getCharPointer(), text.getCharPointer().findTerminatingNull(), breakCharacters }
+        {
+        }
+
+        /** Moves on to the next token, returning false if there aren't any
+            more.
+        */
+        bool moveToNextToken() noexcept
+        {
+            if (finished)
+                return false;
+
+            tokenStart = next;
+            tokenEnd = tokenStart;
+
+            while (tokenEnd != end && !isBreakCharacter(*tokenEnd))
+                ++tokenEnd;
+
+            if (tokenEnd == end)
+            {
+                finished = true;
+            }
+            else
+            {
+                next = tokenEnd;
+                ++next;
+            }
+
+            return true;
+        }
+
+        [[nodiscard]] bool isTokenEmpty() const noexcept
+        {
+            return tokenStart == tokenEnd;
+        }
+
+        [[nodiscard]] juce::CharPointer_UTF8 getTokenStart() const noexcept
+        {
+            return tokenStart;
+        }
+
+        [[nodiscard]] juce::CharPointer_UTF8 getTokenEnd() const noexcept
+        {
+            return tokenEnd;
+        }
+
+        /** Equivalent to juce::String::getIntValue() for the current token. */
+        [[nodiscard]] int getIntValue() const noexcept
+        {
+            if (isTokenEmpty())
+                return 0;
+
+            return juce::CharacterFunctions::getIntValue<int>(tokenStart);
+        }
+
+        /** Equivalent to juce::String::getDoubleValue() for the current token. */
+        [[nodiscard]] double getDoubleValue() const noexcept
+        {
+            if (isTokenEmpty())
+                return 0.0;
+
+            auto text = tokenStart;
+            return juce::CharacterFunctions::readDoubleValue(text);
+        }
+
+        /** Returns the number of tokens juce::StringArray::fromTokens() would
+            have split the text into.
+        */
+        [[nodiscard]] static int countTokens(juce::CharPointer_UTF8 textStart,
+                                             juce::CharPointer_UTF8 textEnd,
+                                             const char* breakCharacters) noexcept
+        {
+            TokenScanner scanner{ textStart, textEnd, breakCharacters };
+            auto count = 0;
+
+            while (scanner.moveToNextToken())
+                count++;
+
+            return count;
+        }
+
+        [[nodiscard]] static int countTokens(const juce::String& text, const char* breakCharacters) noexcept
+        {
+            return countTokens(text.getCharPointer(),
+                               text.getCharPointer().findTerminatingNull(),
+                               breakCharacters);
+        }
+
+    private:
+        [[nodiscard]] bool isBreakCharacter(juce::juce_wchar character) const noexcept
+        {
+            for (const auto* breakCharacter = breaks; *breakCharacter != 0; breakCharacter++)
+            {
+                if (character == static_cast<juce::juce_wchar>(*breakCharacter))
+                    return true;
+            }
+
+            return false;
+        }
+
+        juce::CharPointer_UTF8 next;
+        juce::CharPointer_UTF8 end;
+        juce::CharPointer_UTF8 tokenStart;
+        juce::CharPointer_UTF8 tokenEnd;
+        const char* breaks;
+        bool finished;
+    };
+
+    /** The characters juce::StringArray::fromTokens() breaks on when it's only
+        told whether to preserve quoted strings.
+    */
+    static constexpr auto whitespaceBreakCharacters = " \n\r\t";
+} // namespace jive
@@ -2,7 +2,7 @@
 
 namespace juce
 {
-    const Array<var> VariantConverter<AttributedString::ReadingDirection>::options = {
+    const jive::EnumNames<AttributedString::ReadingDirection> VariantConverter<AttributedString::ReadingDirection>::names = {
         "natural",
         "left-to-right",
         "right-to-left",
@@ -10,19 +10,17 @@ namespace juce
 
     AttributedString::ReadingDirection VariantConverter<AttributedString::ReadingDirection>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<AttributedString::ReadingDirection>(options.indexOf(v));
+        const auto value = names.find(v);
+        jassert(value.has_value());
+        return value.value_or(AttributedString::ReadingDirection{});
     }
 
     var VariantConverter<AttributedString::ReadingDirection>::toVar(const AttributedString::ReadingDirection& direction)
     {
-        const auto index = static_cast<int>(direction);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return names.toVar(direction);
     }
 
-    const Array<var> VariantConverter<AttributedString::WordWrap>::options = {
+    const jive::EnumNames<AttributedString::WordWrap> VariantConverter<AttributedString::WordWrap>::names = {
         "none",
         "by-word",
         "by-character",
@@ -30,15 +28,13 @@ namespace juce
 
     AttributedString::WordWrap VariantConverter<AttributedString::WordWrap>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<AttributedString::WordWrap>(options.indexOf(v));
+        const auto value = names.find(v);
+        jassert(value.has_value());
+        return value.value_or(AttributedString::WordWrap{});
     }
 
     var VariantConverter<AttributedString::WordWrap>::toVar(const AttributedString::WordWrap& wordWrap)
     {
-        const auto index = static_cast<int>(wordWrap);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return names.toVar(wordWrap);
     }
 } // namespace juce
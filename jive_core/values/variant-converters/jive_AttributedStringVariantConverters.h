@@ -1,5 +1,7 @@
 #pragma once
 
+#include "jive_EnumNames.h"
+
 #include <juce_graphics/juce_graphics.h>
 
 namespace juce
@@ -12,7 +14,7 @@ namespace juce
         static var toVar(const AttributedString::ReadingDirection& direction);
 
     private:
-        static const Array<var> options;
+        static const jive::EnumNames<AttributedString::ReadingDirection> names;
     };
 
     template <>
@@ -23,6 +25,6 @@ namespace juce
         static var toVar(const AttributedString::WordWrap& wordWrap);
 
     private:
-        static const Array<var> options;
+        static const jive::EnumNames<AttributedString::WordWrap> names;
     };
 } // namespace juce
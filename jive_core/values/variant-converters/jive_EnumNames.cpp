@@ -0,0 +1,62 @@
+#include "jive_EnumNames.h"
+
+#if JIVE_UNIT_TESTS
+class EnumNamesUnitTest : public juce::UnitTest
+{
+public:
+    EnumNamesUnitTest()
+        : juce::UnitTest{ "jive::EnumNames", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testOrderedNames();
+        testNamedValues();
+    }
+
+private:
+    enum class Fruit
+    {
+        apple,
+        banana,
+        cherry,
+    };
+
+    void testOrderedNames()
+    {
+        beginTest("ordered names");
+
+        const jive::EnumNames<Fruit> names{
+            "apple",
+            "banana",
+            "cherry",
+        };
+        expect(names.find("apple") == Fruit::apple);
+        expect(names.find("cherry") == Fruit::cherry);
+        expect(names.find(juce::String{ "ban" } + "ana") == Fruit::banana);
+        expect(!names.find("durian").has_value());
+        expect(!names.find(juce::var{}).has_value());
+        expect(!names.find(1).has_value());
+
+        const auto name = names.toVar(Fruit::banana);
+        expect(name == juce::var{ "banana" });
+        expect(names.find(name) == Fruit::banana);
+    }
+
+    void testNamedValues()
+    {
+        beginTest("named values");
+
+        const jive::EnumNames<juce::Justification> names{
+            { juce::Justification::topLeft, "top-left" },
+            { juce::Justification::centred, "centred" },
+        };
+        expect(names.find("centred") == juce::Justification{ juce::Justification::centred });
+        expect(names.toVar(juce::Justification::topLeft) == juce::var{ "top-left" });
+        expect(names.toVar(juce::Justification::bottomRight).isVoid());
+    }
+};
+
+static EnumNamesUnitTest enumNamesUnitTest;
+#endif
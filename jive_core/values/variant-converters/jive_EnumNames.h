@@ -0,0 +1,88 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+namespace jive
+{
+    /** Converts between the values of an enum and the names used for them in
+        ValueTrees.
+
+        The names are pooled, and the vars returned by toVar() hold the pooled
+        strings, so a name that was written by toVar() is found again from its
+        address alone. Any other string takes a single hash lookup, rather
+        than being compared against each of the names in turn.
+    */
+    template <typename Enum>
+    class EnumNames
+    {
+    public:
+        /** Names the values of an enum that count up from zero. */
+        EnumNames(std::initializer_list<const char*> orderedNames)
+        {
+            auto index = 0;
+
+            for (const auto* name : orderedNames)
+                add(static_cast<Enum>(index++), name);
+        }
+
+        /** Names each of the given values. */
+        EnumNames(std::initializer_list<std::pair<Enum, const char*>> namedValues)
+        {
+            for (const auto& [value, name] : namedValues)
+                add(value, name);
+        }
+
+        /** Returns the value with the given name, or std::nullopt if there
+            isn't one.
+        */
+        [[nodiscard]] std::optional<Enum> find(const juce::var& name) const
+        {
+            if (!name.isString())
+                return std::nullopt;
+
+            const auto text = name.toString();
+
+            if (const auto pooled = valuesByAddress.find(text.getCharPointer().getAddress());
+                pooled != std::end(valuesByAddress))
+            {
+                return pooled->second;
+            }
+
+            if (const auto named = valuesByName.find(text);
+                named != std::end(valuesByName))
+            {
+                return named->second;
+            }
+
+            return std::nullopt;
+        }
+
+        /** Returns the name of the given value, or a void var if it doesn't
+            have one.
+        */
+        [[nodiscard]] juce::var toVar(const Enum& value) const
+        {
+            for (const auto& [namedValue, name] : names)
+            {
+                if (namedValue == value)
+                    return name;
+            }
+
+            return {};
+        }
+
+    private:
+        void add(const Enum& value, const char* name)
+        {
+            const juce::Identifier pooledName{ name };
+
+            names.emplace_back(value, juce::var{ pooledName.toString() });
+            valuesByAddress.emplace(pooledName.getCharPointer().getAddress(), value);
+            valuesByName.emplace(pooledName.toString(), value);
+        }
+
+        std::vector<std::pair<Enum, juce::var>> names;
+        std::unordered_map<const void*, Enum> valuesByAddress;
+        std::unordered_map<juce::String, Enum> valuesByName;
+    };
+} // namespace jive
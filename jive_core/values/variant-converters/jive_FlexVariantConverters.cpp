@@ -2,7 +2,7 @@
 
 namespace juce
 {
-    const Array<var> VariantConverter<FlexBox::AlignContent>::options = {
+    const jive::EnumNames<FlexBox::AlignContent> VariantConverter<FlexBox::AlignContent>::names = {
         "stretch",
         "flex-start",
         "flex-end",
@@ -16,19 +16,17 @@ namespace juce
         if (v.isVoid())
             return FlexBox{}.alignContent;
 
-        jassert(options.contains(v));
-        return static_cast<FlexBox::AlignContent>(options.indexOf(v));
+        const auto value = names.find(v);
+        jassert(value.has_value());
+        return value.value_or(FlexBox::AlignContent{});
     }
 
     var VariantConverter<FlexBox::AlignContent>::toVar(FlexBox::AlignContent justification)
     {
-        const auto index = static_cast<int>(justification);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return names.toVar(justification);
     }
 
-    const Array<var> VariantConverter<FlexBox::AlignItems>::options = {
+    const jive::EnumNames<FlexBox::AlignItems> VariantConverter<FlexBox::AlignItems>::names = {
         "stretch",
         "flex-start",
         "flex-end",
@@ -40,19 +38,17 @@ namespace juce
         if (v.isVoid())
             return FlexBox{}.alignItems;
 
-        jassert(options.contains(v));
-        return static_cast<FlexBox::AlignItems>(options.indexOf(v));
+        const auto value = names.find(v);
+        jassert(value.has_value());
+        return value.value_or(FlexBox::AlignItems{});
     }
 
     var VariantConverter<FlexBox::AlignItems>::toVar(FlexBox::AlignItems alignment)
     {
-        const auto index = static_cast<int>(alignment);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return names.toVar(alignment);
     }
 
-    const Array<var> VariantConverter<FlexBox::Direction>::options = {
+    const jive::EnumNames<FlexBox::Direction> VariantConverter<FlexBox::Direction>::names = {
         "row",
         "row-reverse",
         "column",
@@ -64,19 +60,17 @@ namespace juce
         if (v.isVoid())
             return FlexBox{}.flexDirection;
 
-        jassert(options.contains(v));
-        return static_cast<FlexBox::Direction>(options.indexOf(v));
+        const auto value = names.find(v);
+        jassert(value.has_value());
+        return value.value_or(FlexBox::Direction{});
     }
 
     var VariantConverter<FlexBox::Direction>::toVar(FlexBox::Direction direction)
     {
-        const auto index = static_cast<int>(direction);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return names.toVar(direction);
     }
 
-    const Array<var> VariantConverter<FlexBox::JustifyContent>::options = {
+    const jive::EnumNames<FlexBox::JustifyContent> VariantConverter<FlexBox::JustifyContent>::names = {
         "flex-start",
         "flex-end",
         "centre",
@@ -89,19 +83,17 @@ namespace juce
         if (v.isVoid())
             return FlexBox{}.justifyContent;
 
-        jassert(options.contains(v));
-        return static_cast<FlexBox::JustifyContent>(options.indexOf(v));
+        const auto value = names.find(v);
+        jassert(value.has_value());
+        return value.value_or(FlexBox::JustifyContent{});
     }
 
     var VariantConverter<FlexBox::JustifyContent>::toVar(FlexBox::JustifyContent justification)
     {
-        const auto index = static_cast<int>(justification);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return names.toVar(justification);
     }
 
-    const Array<var> VariantConverter<FlexBox::Wrap>::options = {
+    const jive::EnumNames<FlexBox::Wrap> VariantConverter<FlexBox::Wrap>::names = {
         "nowrap",
         "wrap",
         "wrap-reverse"
@@ -112,19 +104,17 @@ namespace juce
         if (v.isVoid())
             return FlexBox{}.flexWrap;
 
-        jassert(options.contains(v));
-        return static_cast<FlexBox::Wrap>(options.indexOf(v));
+        const auto value = names.find(v);
+        jassert(value.has_value());
+        return value.value_or(FlexBox::Wrap{});
     }
 
     var VariantConverter<FlexBox::Wrap>::toVar(FlexBox::Wrap wrap)
     {
-        const auto index = static_cast<int>(wrap);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return names.toVar(wrap);
     }
 
-    const Array<var> VariantConverter<FlexItem::AlignSelf>::options = {
+    const jive::EnumNames<FlexItem::AlignSelf> VariantConverter<FlexItem::AlignSelf>::names = {
         "auto",
         "flex-start",
         "flex-end",
@@ -137,15 +127,13 @@ namespace juce
         if (v.isVoid())
             return FlexItem{}.alignSelf;
 
-        jassert(options.contains(v));
-        return static_cast<FlexItem::AlignSelf>(options.indexOf(v));
+        const auto value = names.find(v);
+        jassert(value.has_value());
+        return value.value_or(FlexItem::AlignSelf{});
     }
 
     var VariantConverter<FlexItem::AlignSelf>::toVar(FlexItem::AlignSelf alignSelf)
     {
-        const auto index = static_cast<int>(alignSelf);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return names.toVar(alignSelf);
     }
 } // namespace juce
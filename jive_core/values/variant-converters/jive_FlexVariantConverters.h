@@ -1,5 +1,7 @@
 #pragma once
 
+#include "jive_EnumNames.h"
+
 #include <juce_gui_basics/juce_gui_basics.h>
 
 namespace juce
@@ -11,7 +13,7 @@ namespace juce
         static var toVar(FlexBox::AlignContent direction);
 
     private:
-        static const Array<var> options;
+        static const jive::EnumNames<FlexBox::AlignContent> names;
     };
 
     template <>
@@ -21,7 +23,7 @@ namespace juce
         static var toVar(FlexBox::AlignItems direction);
 
     private:
-        static const Array<var> options;
+        static const jive::EnumNames<FlexBox::AlignItems> names;
     };
 
     template <>
@@ -31,7 +33,7 @@ namespace juce
         static var toVar(FlexBox::Direction direction);
 
     private:
-        static const Array<var> options;
+        static const jive::EnumNames<FlexBox::Direction> names;
     };
 
     template <>
@@ -41,7 +43,7 @@ namespace juce
         static var toVar(FlexBox::JustifyContent direction);
 
     private:
-        static const Array<var> options;
+        static const jive::EnumNames<FlexBox::JustifyContent> names;
     };
 
     template <>
@@ -51,7 +53,7 @@ namespace juce
         static var toVar(FlexBox::Wrap direction);
 
     private:
-        static const Array<var> options;
+        static const jive::EnumNames<FlexBox::Wrap> names;
     };
 
     template <>
@@ -61,6 +63,6 @@ namespace juce
         static var toVar(FlexItem::AlignSelf alignSelf);
 
     private:
-        static const Array<var> options;
+        static const jive::EnumNames<FlexItem::AlignSelf> names;
     };
 } // namespace juce
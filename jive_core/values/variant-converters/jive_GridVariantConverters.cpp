@@ -2,7 +2,7 @@
 
 namespace juce
 {
-    const Array<var> VariantConverter<GridItem::JustifySelf>::options = {
+    const jive::EnumNames<GridItem::JustifySelf> VariantConverter<GridItem::JustifySelf>::names = {
         "start",
         "end",
         "centre",
@@ -12,19 +12,17 @@ namespace juce
 
     GridItem::JustifySelf VariantConverter<GridItem::JustifySelf>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<GridItem::JustifySelf>(options.indexOf(v));
+        const auto value = names.find(v);
+        jassert(value.has_value());
+        return value.value_or(GridItem::JustifySelf{});
     }
 
     var VariantConverter<GridItem::JustifySelf>::toVar(GridItem::JustifySelf justification)
     {
-        const auto index = static_cast<int>(justification);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return names.toVar(justification);
     }
 
-    const Array<var> VariantConverter<GridItem::AlignSelf>::options = {
+    const jive::EnumNames<GridItem::AlignSelf> VariantConverter<GridItem::AlignSelf>::names = {
         "start",
         "end",
         "centre",
@@ -34,16 +32,14 @@ namespace juce
 
     GridItem::AlignSelf VariantConverter<GridItem::AlignSelf>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<GridItem::AlignSelf>(options.indexOf(v));
+        const auto value = names.find(v);
+        jassert(value.has_value());
+        return value.value_or(GridItem::AlignSelf{});
     }
 
     var VariantConverter<GridItem::AlignSelf>::toVar(GridItem::AlignSelf alignment)
     {
-        const auto index = static_cast<int>(alignment);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return names.toVar(alignment);
     }
 
     GridItem::Span VariantConverter<GridItem::Span>::fromVar(const var& v)
@@ -125,7 +121,7 @@ namespace juce
         return tokens.joinIntoString(" / ");
     }
 
-    const Array<var> VariantConverter<Grid::JustifyItems>::options = {
+    const jive::EnumNames<Grid::JustifyItems> VariantConverter<Grid::JustifyItems>::names = {
         "start",
         "end",
         "centre",
@@ -134,19 +130,17 @@ namespace juce
 
     Grid::JustifyItems VariantConverter<Grid::JustifyItems>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<Grid::JustifyItems>(options.indexOf(v));
+        const auto value = names.find(v);
+        jassert(value.has_value());
+        return value.value_or(Grid::JustifyItems{});
     }
 
     var VariantConverter<Grid::JustifyItems>::toVar(Grid::JustifyItems justification)
     {
-        const auto index = static_cast<int>(justification);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return names.toVar(justification);
     }
 
-    const Array<var> VariantConverter<Grid::AlignItems>::options = {
+    const jive::EnumNames<Grid::AlignItems> VariantConverter<Grid::AlignItems>::names = {
         "start",
         "end",
         "centre",
@@ -155,19 +149,17 @@ namespace juce
 
     Grid::AlignItems VariantConverter<Grid::AlignItems>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<Grid::AlignItems>(options.indexOf(v));
+        const auto value = names.find(v);
+        jassert(value.has_value());
+        return value.value_or(Grid::AlignItems{});
     }
 
     var VariantConverter<Grid::AlignItems>::toVar(Grid::AlignItems alignment)
     {
-        const auto index = static_cast<int>(alignment);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return names.toVar(alignment);
     }
 
-    const Array<var> VariantConverter<Grid::JustifyContent>::options = {
+    const jive::EnumNames<Grid::JustifyContent> VariantConverter<Grid::JustifyContent>::names = {
         "start",
         "end",
         "centre",
@@ -179,19 +171,17 @@ namespace juce
 
     Grid::JustifyContent VariantConverter<Grid::JustifyContent>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<Grid::JustifyContent>(options.indexOf(v));
+        const auto value = names.find(v);
+        jassert(value.has_value());
+        return value.value_or(Grid::JustifyContent{});
     }
 
     var VariantConverter<Grid::JustifyContent>::toVar(Grid::JustifyContent justification)
     {
-        const auto index = static_cast<int>(justification);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return names.toVar(justification);
     }
 
-    const Array<var> VariantConverter<Grid::AlignContent>::options = {
+    const jive::EnumNames<Grid::AlignContent> VariantConverter<Grid::AlignContent>::names = {
         "start",
         "end",
         "centre",
@@ -203,19 +193,17 @@ namespace juce
 
     Grid::AlignContent VariantConverter<Grid::AlignContent>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<Grid::AlignContent>(options.indexOf(v));
+        const auto value = names.find(v);
+        jassert(value.has_value());
+        return value.value_or(Grid::AlignContent{});
     }
 
     var VariantConverter<Grid::AlignContent>::toVar(Grid::AlignContent alignment)
     {
-        const auto index = static_cast<int>(alignment);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return names.toVar(alignment);
     }
 
-    const Array<var> VariantConverter<Grid::AutoFlow>::options = {
+    const jive::EnumNames<Grid::AutoFlow> VariantConverter<Grid::AutoFlow>::names = {
         "row",
         "column",
         "row dense",
@@ -224,16 +212,14 @@ namespace juce
 
     Grid::AutoFlow VariantConverter<Grid::AutoFlow>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<Grid::AutoFlow>(options.indexOf(v));
+        const auto value = names.find(v);
+        jassert(value.has_value());
+        return value.value_or(Grid::AutoFlow{});
     }
 
     var VariantConverter<Grid::AutoFlow>::toVar(Grid::AutoFlow flow)
     {
-        const auto index = static_cast<int>(flow);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return names.toVar(flow);
     }
 
     Grid::TrackInfo VariantConverter<Grid::TrackInfo>::fromVar(const var& v)
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "jive_EnumNames.h"
+
 #include <juce_gui_basics/juce_gui_basics.h>
 
 namespace juce
@@ -11,7 +13,7 @@ namespace juce
         static var toVar(GridItem::JustifySelf justification);
 
     private:
-        static const Array<var> options;
+        static const jive::EnumNames<GridItem::JustifySelf> names;
     };
 
     template <>
@@ -21,7 +23,7 @@ namespace juce
         static var toVar(GridItem::AlignSelf alignment);
 
     private:
-        static const Array<var> options;
+        static const jive::EnumNames<GridItem::AlignSelf> names;
     };
 
     template <>
@@ -52,7 +54,7 @@ namespace juce
         static var toVar(Grid::JustifyItems justification);
 
     private:
-        static const Array<var> options;
+        static const jive::EnumNames<Grid::JustifyItems> names;
     };
 
     template <>
@@ -62,7 +64,7 @@ namespace juce
         static var toVar(Grid::AlignItems alignment);
 
     private:
-        static const Array<var> options;
+        static const jive::EnumNames<Grid::AlignItems> names;
     };
 
     template <>
@@ -72,7 +74,7 @@ namespace juce
         static var toVar(Grid::JustifyContent alignment);
 
     private:
-        static const Array<var> options;
+        static const jive::EnumNames<Grid::JustifyContent> names;
     };
 
     template <>
@@ -82,7 +84,7 @@ namespace juce
         static var toVar(Grid::AlignContent alignment);
 
     private:
-        static const Array<var> options;
+        static const jive::EnumNames<Grid::AlignContent> names;
     };
 
     template <>
@@ -92,7 +94,7 @@ namespace juce
         static var toVar(Grid::AutoFlow flow);
 
     private:
-        static const Array<var> options;
+        static const jive::EnumNames<Grid::AutoFlow> names;
     };
 
     template <>
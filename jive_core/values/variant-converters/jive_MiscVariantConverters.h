@@ -1,6 +1,9 @@
 #pragma once
 
+#include "jive_EnumNames.h"
+
 #include <jive_core/values/jive_Colours.h>
+#include <jive_core/values/jive_TokenScanner.h>
 
 #include <juce_gui_basics/juce_gui_basics.h>
 
@@ -11,51 +14,26 @@ namespace juce
     {
         static Justification fromVar(const var& v)
         {
-            if (v == "centred-left")
-                return Justification::centredLeft;
-            else if (v == "top-left")
-                return Justification::topLeft;
-            else if (v == "centred-top")
-                return Justification::centredTop;
-            else if (v == "top-right")
-                return Justification::topRight;
-            else if (v == "centred-right")
-                return Justification::centredRight;
-            else if (v == "bottom-right")
-                return Justification::bottomRight;
-            else if (v == "centred-bottom")
-                return Justification::centredBottom;
-            else if (v == "bottom-left")
-                return Justification::bottomLeft;
-            else if (v == "centred")
-                return Justification::centred;
-
-            return Justification::centred;
+            return names.find(v).value_or(Justification::centred);
         }
 
         static var toVar(Justification justification)
         {
-            if (justification == Justification::centredLeft)
-                return "centred-left";
-            else if (justification == Justification::topLeft)
-                return "top-left";
-            else if (justification == Justification::centredTop)
-                return "centred-top";
-            else if (justification == Justification::topRight)
-                return "top-right";
-            else if (justification == Justification::centredRight)
-                return "centred-right";
-            else if (justification == Justification::bottomRight)
-                return "bottom-right";
-            else if (justification == Justification::centredBottom)
-                return "centred-bottom";
-            else if (justification == Justification::bottomLeft)
-                return "bottom-left";
-            else if (justification == Justification::centred)
-                return "centred";
-
-            return {};
+            return names.toVar(justification);
         }
+
+    private:
+        static const inline jive::EnumNames<Justification> names{
+            { Justification::centredLeft, "centred-left" },
+            { Justification::topLeft, "top-left" },
+            { Justification::centredTop, "centred-top" },
+            { Justification::topRight, "top-right" },
+            { Justification::centredRight, "centred-right" },
+            { Justification::bottomRight, "bottom-right" },
+            { Justification::centredBottom, "centred-bottom" },
+            { Justification::bottomLeft, "bottom-left" },
+            { Justification::centred, "centred" },
+        };
     };
 
     template <typename ValueType>
@@ -63,35 +41,31 @@ namespace juce
     {
         static BorderSize<ValueType> fromVar(const var& v)
         {
-            const auto tokens = StringArray::fromTokens(v.toString(), false);
-
-            if (tokens.size() == 1)
-            {
+            if (!v.isString())
                 return BorderSize<ValueType>{ static_cast<float>(v) };
-            }
-            if (tokens.size() == 2)
-            {
-                const auto topAndBottom = static_cast<ValueType>(tokens[0].getDoubleValue());
-                const auto leftAndRight = static_cast<ValueType>(tokens[1].getDoubleValue());
 
-                return BorderSize<ValueType>{ topAndBottom, leftAndRight, topAndBottom, leftAndRight };
-            }
-            if (tokens.size() == 3)
-            {
-                const auto top = static_cast<ValueType>(tokens[0].getDoubleValue());
-                const auto leftAndRight = static_cast<ValueType>(tokens[1].getDoubleValue());
-                const auto bottom = static_cast<ValueType>(tokens[2].getDoubleValue());
+            const auto& text = v.toString();
+            std::array<ValueType, 4> values{};
+            auto numTokens = 0;
 
-                return BorderSize<ValueType>{ top, leftAndRight, bottom, leftAndRight };
-            }
-            if (tokens.size() == 4)
+            for (jive::TokenScanner scanner{ text, jive::whitespaceBreakCharacters };
+                 scanner.moveToNextToken();
+                 numTokens++)
             {
-                const auto top = static_cast<ValueType>(tokens[0].getDoubleValue());
-                const auto right = static_cast<ValueType>(tokens[1].getDoubleValue());
-                const auto bottom = static_cast<ValueType>(tokens[2].getDoubleValue());
-                const auto left = static_cast<ValueType>(tokens[3].getDoubleValue());
+                if (numTokens < static_cast<int>(std::size(values)))
+                    values[static_cast<std::size_t>(numTokens)] = static_cast<ValueType>(scanner.getDoubleValue());
+            }
 
-                return BorderSize<ValueType>{ top, left, bottom, right };
+            switch (numTokens)
+            {
+            case 1:
+                return BorderSize<ValueType>{ static_cast<float>(v) };
+            case 2:
+                return BorderSize<ValueType>{ values[0], values[1], values[0], values[1] };
+            case 3:
+                return BorderSize<ValueType>{ values[0], values[1], values[2], values[1] };
+            case 4:
+                return BorderSize<ValueType>{ values[0], values[3], values[2], values[1] };
             }
 
             return BorderSize<ValueType>{};
@@ -132,20 +106,18 @@ namespace juce
     {
         static MouseCursor::StandardCursorType fromVar(const var& v)
         {
-            jassert(options.contains(v));
-            return static_cast<MouseCursor::StandardCursorType>(options.indexOf(v));
+            const auto cursor = names.find(v);
+            jassert(cursor.has_value());
+            return cursor.value_or(MouseCursor::ParentCursor);
         }
 
         static var toVar(MouseCursor::StandardCursorType cursor)
         {
-            const auto index = static_cast<int>(cursor);
-
-            jassert(options.size() >= index);
-            return options[index];
+            return names.toVar(cursor);
         }
 
     private:
-        static const inline Array<var> options{
+        static const inline jive::EnumNames<MouseCursor::StandardCursorType> names{
             "inherit",
             "none",
             "default",
@@ -385,21 +357,32 @@ namespace juce
     public:
         static Point<Arithmetic> fromVar(const var& value)
         {
-            const auto tokens = StringArray::fromTokens(value.toString(), ",", "");
-            jassert(tokens.size() == 2);
+            const auto& text = value.toString();
+            std::array<double, 2> coordinates{};
+            auto numTokens = 0;
+
+            for (jive::TokenScanner scanner{ text, "," };
+                 scanner.moveToNextToken();
+                 numTokens++)
+            {
+                if (numTokens < static_cast<int>(std::size(coordinates)))
+                    coordinates[static_cast<std::size_t>(numTokens)] = scanner.getDoubleValue();
+            }
+
+            jassert(numTokens == 2);
 
             if constexpr (std::is_integral<Arithmetic>())
             {
                 return {
-                    static_cast<Arithmetic>(std::round(tokens[0].getDoubleValue())),
-                    static_cast<Arithmetic>(std::round(tokens[1].getDoubleValue())),
+                    static_cast<Arithmetic>(std::round(coordinates[0])),
+                    static_cast<Arithmetic>(std::round(coordinates[1])),
                 };
             }
             else
             {
                 return {
-                    static_cast<Arithmetic>(tokens[0].getDoubleValue()),
-                    static_cast<Arithmetic>(tokens[1].getDoubleValue()),
+                    static_cast<Arithmetic>(coordinates[0]),
+                    static_cast<Arithmetic>(coordinates[1]),
                 };
             }
         }
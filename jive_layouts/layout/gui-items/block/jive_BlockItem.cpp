@@ -7,12 +7,12 @@ namespace jive
 {
     BlockItem::BlockItem(std::unique_ptr<GuiItem> itemToDecorate)
         : ContainerItem::Child{ std::move(itemToDecorate) }
-        , x{ state, "x" }
-        , y{ state, "y" }
-        , centreX{ state, "centre-x" }
-        , centreY{ state, "centre-y" }
-        , width{ state, "width" }
-        , height{ state, "height" }
+        , x{ state, ids::x }
+        , y{ state, ids::y }
+        , centreX{ state, ids::centreX }
+        , centreY{ state, ids::centreY }
+        , width{ state, ids::width }
+        , height{ state, ids::height }
     {
         jassert(getParent() != nullptr);
 
@@ -6,12 +6,12 @@ namespace jive
 {
     Image::Image(std::unique_ptr<GuiItem> itemToDecorate)
         : GuiItemDecorator{ std::move(itemToDecorate) }
-        , source{ state, "source" }
-        , placement{ state, "placement" }
-        , width{ state, "width" }
-        , height{ state, "height" }
-        , idealWidth{ state, "ideal-width" }
-        , idealHeight{ state, "ideal-height" }
+        , source{ state, ids::source }
+        , placement{ state, ids::placement }
+        , width{ state, ids::width }
+        , height{ state, ids::height }
+        , idealWidth{ BoxModel::getLayoutState(state), ids::idealWidth }
+        , idealHeight{ BoxModel::getLayoutState(state), ids::idealHeight }
         , boxModel{ toType<CommonGuiItem>()->boxModel }
     {
         const BoxModel::ScopedCallbackLock boxModelLock{ jive::boxModel(*this) };
@@ -5,15 +5,61 @@
 
 namespace jive
 {
+#if JIVE_IS_PLUGIN_PROJECT
+    // Display-only, so unlike juce::ParameterAttachment there are no gestures
+    // to forward. Changes made on the audio thread are coalesced into at most
+    // one update per frame.
+    class Text::ParameterListener : private juce::AudioProcessorParameter::Listener
+    {
+    public:
+        ParameterListener(juce::RangedAudioParameter& parameterToObserve,
+                          const juce::ValueTree& treeToBatch,
+                          std::function<void()> onValueChange)
+            : parameter{ parameterToObserve }
+            , value{ parameter.getValue() }
+        {
+            value.bind(
+                [callback = std::move(onValueChange)](const float&) {
+                    callback();
+                },
+                treeToBatch);
+            parameter.addListener(this);
+        }
+
+        ~ParameterListener() override
+        {
+            parameter.removeListener(this);
+        }
+
+    private:
+        void parameterValueChanged(int, float newValue) final
+        {
+            value.write(newValue);
+        }
+
+        void parameterGestureChanged(int, bool) final
+        {
+        }
+
+        juce::RangedAudioParameter& parameter;
+        RealtimeValue<float> value;
+    };
+#endif
+
     Text::Text(std::unique_ptr<GuiItem> itemToDecorate)
         : GuiItemDecorator{ std::move(itemToDecorate) }
-        , text{ state, "text" }
-        , lineSpacing{ state, "line-spacing" }
-        , justification{ state, "justification" }
-        , wordWrap{ state, "word-wrap" }
-        , direction{ state, "direction" }
-        , idealWidth{ state, "ideal-width" }
-        , idealHeight{ state, "ideal-height" }
+        , text{ state, ids::text }
+        , lineSpacing{ state, ids::lineSpacing }
+        , justification{ state, ids::justification }
+        , wordWrap{ state, ids::wordWrap }
+        , direction{ state, ids::direction }
+        , idealWidth{ BoxModel::getLayoutState(state), ids::idealWidth }
+        , idealHeight{ BoxModel::getLayoutState(state), ids::idealHeight }
+        , idealHeights{
+            [this](float maxWidth) {
+                return calculateIdealHeight(maxWidth);
+            },
+        }
     {
         const BoxModel::ScopedCallbackLock boxModelLock{ boxModel(*this) };
 
@@ -40,12 +86,22 @@ namespace jive
             updateTextComponent();
         };
 
-        state.setProperty("ideal-height",
-                          juce::var{ [this](const juce::var::NativeFunctionArgs& args) {
-                              const auto layout = buildTextLayout(args.arguments[0]);
-                              return std::ceil(layout.getHeight());
-                          } },
-                          nullptr);
+        // Layouts ask for the ideal height repeatedly, usually at only a
+        // handful of widths, whereas the text itself rarely changes. The
+        // layout state can outlive this item, and a width mightn't be given.
+        BoxModel::getLayoutState(state)
+            ->setProperty(idealHeight.id,
+                          juce::var{ [safeThis = juce::WeakReference<GuiItem>{ this }](const juce::var::NativeFunctionArgs& args) -> juce::var {
+                              auto* text = dynamic_cast<Text*>(safeThis.get());
+
+                              if (text == nullptr)
+                                  return {};
+
+                              const auto maxWidth = args.numArguments > 0
+                                                      ? static_cast<float>(args.arguments[0])
+                                                      : -1.0f;
+                              return text->idealHeights.get(text->findMaxWidth(maxWidth));
+                          } });
 
         updateTextComponent();
         getTextComponent().addListener(*this);
@@ -79,21 +135,21 @@ namespace jive
     }
 
 #if JIVE_IS_PLUGIN_PROJECT
-    void Text::attachToParameter(juce::RangedAudioParameter* newParameter, juce::UndoManager* undoManager)
+    void Text::attachToParameter(juce::RangedAudioParameter* newParameter, juce::UndoManager*)
     {
         parameter = newParameter;
 
         if (parameter != nullptr)
         {
-            const auto onChange = [this](float) {
+            const auto onChange = [this] {
                 text = parameter->getCurrentValueAsText();
             };
-            parameterAttachment = std::make_unique<juce::ParameterAttachment>(*parameter, onChange, undoManager);
+            parameterListener = std::make_unique<ParameterListener>(*parameter, state, onChange);
             text = parameter->getCurrentValueAsText();
         }
         else
         {
-            parameterAttachment = nullptr;
+            parameterListener = nullptr;
         }
     }
 #endif
@@ -113,7 +169,7 @@ namespace jive
         updateTextComponent();
     }
 
-    juce::TextLayout Text::buildTextLayout(float maxWidth) const
+    float Text::findMaxWidth(float maxWidth) const
     {
         for (auto* parentItem = getParent();
              maxWidth < 0.0f && parentItem != nullptr;
@@ -126,12 +182,22 @@ namespace jive
             }
         }
 
+        return maxWidth;
+    }
+
+    juce::TextLayout Text::buildTextLayout(float maxWidth) const
+    {
         juce::TextLayout layout;
-        layout.createLayout(getTextComponent().getAttributedString(), maxWidth);
+        layout.createLayout(getTextComponent().getAttributedString(), findMaxWidth(maxWidth));
 
         return layout;
     }
 
+    float Text::calculateIdealHeight(float maxWidth) const
+    {
+        return std::ceil(buildTextLayout(maxWidth).getHeight());
+    }
+
     template <typename T>
     [[nodiscard]] static auto nextWholeNumberAbove(T value)
     {
@@ -153,6 +219,10 @@ namespace jive
         getTextComponent().setWordWrap(wordWrap);
         getTextComponent().clearAttributes();
 
+        // The heights depend on the attributed string, which is rebuilt here
+        // from the properties, the font and any nested text.
+        idealHeights.invalidate();
+
         for (auto* child : getChildren())
         {
             if (const auto* nestedText = dynamic_cast<const GuiItemDecorator*>(child)
@@ -30,7 +30,9 @@ namespace jive
     private:
         void textFontChanged(TextComponent& text) final;
 
+        float findMaxWidth(float maxWidth) const;
         juce::TextLayout buildTextLayout(float maxWidth = -1.0f) const;
+        float calculateIdealHeight(float maxWidth) const;
 
         void updateTextComponent();
 
@@ -42,9 +44,13 @@ namespace jive
         Property<float> idealWidth;
         Property<float> idealHeight;
 
+        Computed<float, float> idealHeights;
+
 #if JIVE_IS_PLUGIN_PROJECT
+        class ParameterListener;
+
         juce::RangedAudioParameter* parameter;
-        std::unique_ptr<juce::ParameterAttachment> parameterAttachment;
+        std::unique_ptr<ParameterListener> parameterListener;
 #endif
 
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Text)
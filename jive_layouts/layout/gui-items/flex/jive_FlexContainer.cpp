@@ -8,14 +8,14 @@ namespace jive
 {
     FlexContainer::FlexContainer(std::unique_ptr<GuiItem> itemToDecorate)
         : ContainerItem{ std::move(itemToDecorate) }
-        , flexDirection{ state, "flex-direction" }
-        , flexWrap{ state, "flex-wrap" }
-        , flexJustifyContent{ state, "justify-content" }
-        , flexAlignItems{ state, "align-items" }
-        , flexAlignContent{ state, "align-content" }
+        , flexDirection{ state, ids::flexDirection }
+        , flexWrap{ state, ids::flexWrap }
+        , flexJustifyContent{ state, ids::justifyContent }
+        , flexAlignItems{ state, ids::alignItems }
+        , flexAlignContent{ state, ids::alignContent }
     {
-        jassert(state.hasProperty("display"));
-        jassert(state["display"] == juce::VariantConverter<Display>::toVar(Display::flex));
+        jassert(state.hasProperty(ids::display));
+        jassert(state[ids::display] == juce::VariantConverter<Display>::toVar(Display::flex));
 
         if (!flexDirection.exists())
             flexDirection = juce::FlexBox::Direction::column;
@@ -35,13 +35,6 @@ namespace jive
         flexAlignContent.onValueChange = [this] {
             callLayoutChildrenWithRecursionLock();
         };
-
-        state.addListener(this);
-    }
-
-    FlexContainer::~FlexContainer()
-    {
-        state.removeListener(this);
     }
 
     void FlexContainer::layOutChildren()
@@ -142,21 +135,10 @@ namespace jive
         }
     }
 
-    void FlexContainer::valueTreePropertyChanged(juce::ValueTree& tree, const juce::Identifier& id)
+    void FlexContainer::idealSizeChanged()
     {
-        if (tree != state && tree.getParent() != state)
-            return;
-
         if (layoutRecursionLock)
-        {
-            static const juce::Array<juce::Identifier> propertiesForWhichChangesRequireAnotherLayOut{
-                "ideal-width",
-                "ideal-height",
-            };
-
-            if (propertiesForWhichChangesRequireAnotherLayOut.contains(id))
-                changesDuringLayout = true;
-        }
+            changesDuringLayout = true;
     }
 
     juce::FlexBox FlexContainer::buildFlexBox(juce::Rectangle<float> bounds,
@@ -4,13 +4,10 @@
 
 namespace jive
 {
-    class FlexContainer
-        : public ContainerItem
-        , private juce::ValueTree::Listener
+    class FlexContainer : public ContainerItem
     {
     public:
         explicit FlexContainer(std::unique_ptr<GuiItem> itemToDecorate);
-        ~FlexContainer() override;
 
         void layOutChildren() override;
 
@@ -20,7 +17,7 @@ namespace jive
         juce::Rectangle<float> calculateIdealSize(juce::Rectangle<float> constraints) const override;
 
     private:
-        void valueTreePropertyChanged(juce::ValueTree&, const juce::Identifier&) final;
+        void idealSizeChanged() final;
 
         juce::FlexBox buildFlexBox(juce::Rectangle<float> bounds, LayoutStrategy strategy);
 
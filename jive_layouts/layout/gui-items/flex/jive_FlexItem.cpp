@@ -38,11 +38,11 @@ namespace jive
 
     FlexItem::FlexItem(std::unique_ptr<GuiItem> itemToDecorate)
         : ContainerItem::Child{ std::move(itemToDecorate) }
-        , order{ state, "order" }
-        , flexGrow{ state, "flex-grow" }
-        , flexShrink{ state, "flex-shrink" }
-        , flexBasis{ state, "flex-basis" }
-        , alignSelf{ state, "align-self" }
+        , order{ state, ids::order }
+        , flexGrow{ state, ids::flexGrow }
+        , flexShrink{ state, ids::flexShrink }
+        , flexBasis{ state, ids::flexBasis }
+        , alignSelf{ state, ids::alignSelf }
         , layoutDummy{ std::make_unique<FlexLayoutDummy>(*this) }
     {
         if (!flexShrink.exists())
@@ -92,7 +92,7 @@ namespace jive
             const auto orientation = [this]() {
                 const Property<juce::FlexBox::Direction> parentDirection{
                     state.getParent(),
-                    "flex-direction",
+                    ids::flexDirection,
                 };
                 const auto direction = parentDirection.get();
 
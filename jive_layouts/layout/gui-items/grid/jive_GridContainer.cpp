@@ -9,53 +9,30 @@ namespace jive
 {
     GridContainer::GridContainer(std::unique_ptr<GuiItem> itemToDecorate)
         : ContainerItem(std::move(itemToDecorate))
-        , justifyItems{ state, "justify-items" }
-        , alignItems{ state, "align-items" }
-        , justifyContent{ state, "justify-content" }
-        , alignContent{ state, "align-content" }
-        , gridAutoFlow{ state, "grid-auto-flow" }
-        , gridTemplateColumns{ state, "grid-template-columns" }
-        , gridTemplateRows{ state, "grid-template-rows" }
-        , gridTemplateAreas{ state, "grid-template-areas" }
-        , gridAutoRows{ state, "grid-auto-rows" }
-        , gridAutoColumns{ state, "grid-auto-columns" }
-        , gap{ state, "gap" }
+        , properties{ state }
+        , gridTemplateColumns{ state, ids::gridTemplateColumns }
+        , gridTemplateRows{ state, ids::gridTemplateRows }
+        , gap{ state, ids::gap }
     {
-        jassert(state.hasProperty("display"));
-        jassert(state["display"] == juce::VariantConverter<Display>::toVar(Display::grid));
-
-        static const juce::Grid defaultGrid;
-
-        if (!justifyItems.exists())
-            justifyItems = defaultGrid.justifyItems;
-        if (!alignItems.exists())
-            alignItems = defaultGrid.alignItems;
-        if (!justifyContent.exists())
-            justifyContent = defaultGrid.justifyContent;
-        if (!alignContent.exists())
-            alignContent = defaultGrid.alignContent;
-        if (!gridAutoFlow.exists())
-            gridAutoFlow = defaultGrid.autoFlow;
-        if (!gridAutoRows.exists())
-            gridAutoRows = defaultGrid.autoRows;
-        if (!gridAutoColumns.exists())
-            gridAutoColumns = defaultGrid.autoColumns;
-
-        justifyItems.onValueChange = [this] {
-            callLayoutChildrenWithRecursionLock();
-        };
-        alignItems.onValueChange = [this] {
-            callLayoutChildrenWithRecursionLock();
-        };
-        justifyContent.onValueChange = [this] {
-            callLayoutChildrenWithRecursionLock();
-        };
-        alignContent.onValueChange = [this] {
-            callLayoutChildrenWithRecursionLock();
-        };
-        gridAutoFlow.onValueChange = [this] {
-            updateIdealSizeUnrestrained();
+        jassert(state.hasProperty(ids::display));
+        jassert(state[ids::display] == juce::VariantConverter<Display>::toVar(Display::grid));
+
+        properties.applyDefaults();
+        properties.onValueChange = [this](std::size_t slot) {
+            switch (slot)
+            {
+            case Schema::justifyItems:
+            case Schema::alignItems:
+            case Schema::justifyContent:
+            case Schema::alignContent:
+                callLayoutChildrenWithRecursionLock();
+                break;
+            default:
+                updateIdealSizeUnrestrained();
+                break;
+            }
         };
+
         gridTemplateColumns.onValueChange = [this] {
             updateIdealSizeUnrestrained();
         };
@@ -68,28 +45,12 @@ namespace jive
         gridTemplateRows.onTransitionProgressed = [this] {
             updateIdealSizeUnrestrained();
         };
-        gridTemplateAreas.onValueChange = [this] {
-            updateIdealSizeUnrestrained();
-        };
-        gridAutoRows.onValueChange = [this] {
-            updateIdealSizeUnrestrained();
-        };
-        gridAutoColumns.onValueChange = [this] {
-            updateIdealSizeUnrestrained();
-        };
         gap.onValueChange = [this] {
             updateIdealSizeUnrestrained();
         };
         gap.onTransitionProgressed = [this] {
             updateIdealSizeUnrestrained();
         };
-
-        state.addListener(this);
-    }
-
-    GridContainer::~GridContainer()
-    {
-        state.removeListener(this);
     }
 
     void GridContainer::layOutChildren()
@@ -178,21 +139,10 @@ namespace jive
         }
     }
 
-    void GridContainer::valueTreePropertyChanged(juce::ValueTree& tree, const juce::Identifier& id)
+    void GridContainer::idealSizeChanged()
     {
-        if (tree != state && tree.getParent() != state)
-            return;
-
         if (layoutRecursionLock)
-        {
-            static const juce::Array<juce::Identifier> propertiesForWhichChangesRequireAnotherLayOut{
-                "ideal-width",
-                "ideal-height",
-            };
-
-            if (propertiesForWhichChangesRequireAnotherLayOut.contains(id))
-                changesDuringLayout = true;
-        }
+            changesDuringLayout = true;
     }
 
     juce::Grid GridContainer::buildGrid(juce::Rectangle<int> bounds,
@@ -200,12 +150,12 @@ namespace jive
     {
         juce::Grid grid;
 
-        grid.autoFlow = gridAutoFlow;
+        grid.autoFlow = properties.get<Schema::gridAutoFlow>();
         grid.templateColumns = gridTemplateColumns.calculateCurrent();
         grid.templateRows = gridTemplateRows.calculateCurrent();
-        grid.templateAreas = gridTemplateAreas;
-        grid.autoRows = gridAutoRows;
-        grid.autoColumns = gridAutoColumns;
+        grid.templateAreas = properties.get<Schema::gridTemplateAreas>();
+        grid.autoRows = properties.get<Schema::gridAutoRows>();
+        grid.autoColumns = properties.get<Schema::gridAutoColumns>();
 
         const auto gaps = gap.calculateCurrent();
         grid.rowGap = gaps.size() > 0 ? gaps.getUnchecked(0) : juce::Grid::Px{ 0 };
@@ -216,10 +166,10 @@ namespace jive
         switch (strategy)
         {
         case LayoutStrategy::real:
-            grid.justifyItems = justifyItems;
-            grid.alignItems = alignItems;
-            grid.justifyContent = justifyContent;
-            grid.alignContent = alignContent;
+            grid.justifyItems = properties.get<Schema::justifyItems>();
+            grid.alignItems = properties.get<Schema::alignItems>();
+            grid.justifyContent = properties.get<Schema::justifyContent>();
+            grid.alignContent = properties.get<Schema::alignContent>();
             break;
         case LayoutStrategy::dummy:
             grid.justifyItems = juce::Grid::JustifyItems::start;
@@ -4,13 +4,10 @@
 
 namespace jive
 {
-    class GridContainer
-        : public ContainerItem
-        , private juce::ValueTree::Listener
+    class GridContainer : public ContainerItem
     {
     public:
         explicit GridContainer(std::unique_ptr<GuiItem> itemToDecorate);
-        ~GridContainer() override;
 
         void layOutChildren() override;
 
@@ -20,21 +17,53 @@ namespace jive
         juce::Rectangle<float> calculateIdealSize(juce::Rectangle<float> constraints) const override;
 
     private:
-        void valueTreePropertyChanged(juce::ValueTree&, const juce::Identifier&) final;
+        struct Schema
+        {
+            enum Slot
+            {
+                justifyItems,
+                alignItems,
+                justifyContent,
+                alignContent,
+                gridAutoFlow,
+                gridTemplateAreas,
+                gridAutoRows,
+                gridAutoColumns,
+            };
+
+            static constexpr auto entries = std::make_tuple(
+                PropertySchemaEntry<juce::Grid::JustifyItems>{ "justify-items", [] {
+                                                                  return juce::Grid{}.justifyItems;
+                                                              } },
+                PropertySchemaEntry<juce::Grid::AlignItems>{ "align-items", [] {
+                                                                return juce::Grid{}.alignItems;
+                                                            } },
+                PropertySchemaEntry<juce::Grid::JustifyContent>{ "justify-content", [] {
+                                                                    return juce::Grid{}.justifyContent;
+                                                                } },
+                PropertySchemaEntry<juce::Grid::AlignContent>{ "align-content", [] {
+                                                                  return juce::Grid{}.alignContent;
+                                                              } },
+                PropertySchemaEntry<juce::Grid::AutoFlow>{ "grid-auto-flow", [] {
+                                                              return juce::Grid{}.autoFlow;
+                                                          } },
+                PropertySchemaEntry<juce::StringArray>{ "grid-template-areas" },
+                PropertySchemaEntry<juce::Grid::TrackInfo>{ "grid-auto-rows", [] {
+                                                               return juce::Grid{}.autoRows;
+                                                           } },
+                PropertySchemaEntry<juce::Grid::TrackInfo>{ "grid-auto-columns", [] {
+                                                               return juce::Grid{}.autoColumns;
+                                                           } });
+        };
+
+        void idealSizeChanged() final;
 
         juce::Grid buildGrid(juce::Rectangle<int> bounds,
                              LayoutStrategy strategy);
 
-        Property<juce::Grid::JustifyItems> justifyItems;
-        Property<juce::Grid::AlignItems> alignItems;
-        Property<juce::Grid::JustifyContent> justifyContent;
-        Property<juce::Grid::AlignContent> alignContent;
-        Property<juce::Grid::AutoFlow> gridAutoFlow;
+        PropertyTable<Schema> properties;
         Property<juce::Array<juce::Grid::TrackInfo>> gridTemplateColumns;
         Property<juce::Array<juce::Grid::TrackInfo>> gridTemplateRows;
-        Property<juce::StringArray> gridTemplateAreas;
-        Property<juce::Grid::TrackInfo> gridAutoRows;
-        Property<juce::Grid::TrackInfo> gridAutoColumns;
         Property<juce::Array<juce::Grid::Px>> gap;
 
         bool layoutRecursionLock = false;
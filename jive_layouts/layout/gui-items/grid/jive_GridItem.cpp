@@ -4,12 +4,12 @@ namespace jive
 {
     GridItem::GridItem(std::unique_ptr<GuiItem> itemToDecorate)
         : ContainerItem::Child{ std::move(itemToDecorate) }
-        , order{ state, "order" }
-        , justifySelf{ state, "justify-self" }
-        , alignSelf{ state, "align-self" }
-        , gridColumn{ state, "grid-column" }
-        , gridRow{ state, "grid-row" }
-        , gridArea{ state, "grid-area" }
+        , order{ state, ids::order }
+        , justifySelf{ state, ids::justifySelf }
+        , alignSelf{ state, ids::alignSelf }
+        , gridColumn{ state, ids::gridColumn }
+        , gridRow{ state, ids::gridRow }
+        , gridArea{ state, ids::gridArea }
     {
         static const juce::GridItem defaultGridItem;
 
@@ -8,120 +8,26 @@ namespace jive
 #if !JIVE_GUI_ITEMS_HAVE_STYLE_SHEETS
         , interactionState{ *getComponent(), state }
 #endif
-        , name{ state, "name" }
-        , title{ state, "title" }
-        , id{ state, "id" }
-        , description{ state, "description" }
-        , tooltip{ state, "tooltip" }
-        , enabled{ state, "enabled" }
-        , accessible{ state, "accessible" }
-        , visibility{ state, "visibility" }
-        , alwaysOnTop{ state, "always-on-top" }
-        , bufferedToImage{ state, "buffered-to-image" }
-        , opaque{ state, "opaque" }
-        , focusable{ state, "focusable" }
-        , clickingGrabsFocus{ state, "clicking-grabs-focus" }
-        , focusOutline{ state, "focus-outline" }
-        , focusOrder{ state, "focus-order" }
-        , opacity{ state, "opacity" }
-        , cursor{ state, "cursor" }
-        , display{ state, "display" }
-        , width{ state, "width" }
-        , height{ state, "height" }
+        , properties{ state }
+        , opacity{ state, ids::opacity }
+        , width{ state, ids::width }
+        , height{ state, ids::height }
     {
-        if (!enabled.exists())
-            enabled = true;
-        if (!accessible.exists())
-            accessible = true;
-        if (!visibility.exists())
-            visibility = true;
-        if (!clickingGrabsFocus.exists())
-            clickingGrabsFocus = true;
-        if (!focusOrder.exists())
-            focusOrder = state.getParent().indexOf(state) + 1;
+        properties.applyDefaults();
+
+        if (!properties.exists<Schema::focusOrder>())
+            properties.set<Schema::focusOrder>(state.getParent().indexOf(state) + 1);
         if (!opacity.exists())
             opacity = 1.0f;
-        if (!cursor.exists())
-            cursor = juce::MouseCursor::NormalCursor;
-        if (!display.exists())
-            display = Display::flex;
 
         getComponent()->addComponentListener(this);
 
-        name.onValueChange = [this]() {
-            getComponent()->setName(name);
-        };
-        getComponent()->setName(name);
-
-        title.onValueChange = [this]() {
-            getComponent()->setTitle(title);
-        };
-        getComponent()->setTitle(title);
-
-        id.onValueChange = [this]() {
-            getComponent()->setComponentID(id.get().toString());
-        };
-        getComponent()->setComponentID(id.get().toString());
-
-        description.onValueChange = [this]() {
-            getComponent()->setDescription(description);
-        };
-        getComponent()->setDescription(description);
-
-        tooltip.onValueChange = [this]() {
-            getComponent()->setHelpText(tooltip);
-        };
-        getComponent()->setHelpText(tooltip);
-
-        enabled.onValueChange = [this]() {
-            getComponent()->setEnabled(enabled);
-        };
-        getComponent()->setEnabled(enabled);
-
-        accessible.onValueChange = [this]() {
-            getComponent()->setAccessible(accessible);
-        };
-        getComponent()->setAccessible(accessible);
-
-        visibility.onValueChange = [this]() {
-            getComponent()->setVisible(visibility);
-        };
-        getComponent()->setVisible(visibility);
-
-        alwaysOnTop.onValueChange = [this]() {
-            getComponent()->setAlwaysOnTop(alwaysOnTop);
+        properties.onValueChange = [this](std::size_t slot) {
+            applyProperty(slot);
         };
-        getComponent()->setAlwaysOnTop(alwaysOnTop);
 
-        bufferedToImage.onValueChange = [this]() {
-            getComponent()->setBufferedToImage(bufferedToImage);
-        };
-        getComponent()->setBufferedToImage(bufferedToImage);
-
-        opaque.onValueChange = [this]() {
-            getComponent()->setOpaque(opaque);
-        };
-        getComponent()->setOpaque(opaque);
-
-        focusable.onValueChange = [this]() {
-            getComponent()->setWantsKeyboardFocus(focusable);
-        };
-        getComponent()->setWantsKeyboardFocus(focusable);
-
-        focusOutline.onValueChange = [this]() {
-            getComponent()->setHasFocusOutline(focusOutline);
-        };
-        getComponent()->setHasFocusOutline(focusOutline);
-
-        clickingGrabsFocus.onValueChange = [this]() {
-            getComponent()->setMouseClickGrabsKeyboardFocus(clickingGrabsFocus);
-        };
-        getComponent()->setMouseClickGrabsKeyboardFocus(clickingGrabsFocus);
-
-        focusOrder.onValueChange = [this]() {
-            getComponent()->setExplicitFocusOrder(focusOrder);
-        };
-        getComponent()->setExplicitFocusOrder(focusOrder);
+        for (std::size_t slot = 0; slot < PropertyTable<Schema>::numSlots; slot++)
+            applyProperty(slot);
 
         const auto updateOpacity = [this] {
             getComponent()->setAlpha(opacity.calculateCurrent());
@@ -130,11 +36,6 @@ namespace jive
         opacity.onTransitionProgressed = updateOpacity;
         getComponent()->setAlpha(opacity);
 
-        cursor.onValueChange = [this]() {
-            getComponent()->setMouseCursor(juce::MouseCursor{ cursor });
-        };
-        getComponent()->setMouseCursor(juce::MouseCursor{ cursor });
-
         if (isTopLevel())
         {
             // Top-level items must have an explicit size!
@@ -178,7 +79,7 @@ namespace jive
         if (&componentThatChangedVisiblity != getComponent().get())
             return;
 
-        visibility = getComponent()->isVisible();
+        properties.set<Schema::visibility>(getComponent()->isVisible());
     }
 
     void CommonGuiItem::componentNameChanged(juce::Component& componentThatChangedName)
@@ -186,7 +87,7 @@ namespace jive
         if (&componentThatChangedName != getComponent().get())
             return;
 
-        name = getComponent()->getName();
+        properties.set<Schema::name>(getComponent()->getName());
     }
 
     void CommonGuiItem::componentEnablementChanged(juce::Component& componentThatChangedEnablement)
@@ -194,7 +95,7 @@ namespace jive
         if (&componentThatChangedEnablement != getComponent().get())
             return;
 
-        enabled = getComponent()->isEnabled();
+        properties.set<Schema::enabled>(getComponent()->isEnabled());
     }
 
     [[nodiscard]] static auto hasWidgetRole(const juce::Component& component)
@@ -254,7 +155,7 @@ namespace jive
             if (hasWidgetRole(*parentComponent))
                 getComponent()->setAccessible(false);
             else
-                getComponent()->setAccessible(accessible);
+                getComponent()->setAccessible(properties.get<Schema::accessible>());
         }
     }
 
@@ -273,6 +174,66 @@ namespace jive
     {
         getTopLevelDecorator().callLayoutChildrenWithRecursionLock();
     }
+
+    void CommonGuiItem::applyProperty(std::size_t slot)
+    {
+        auto& component = *getComponent();
+
+        switch (slot)
+        {
+        case Schema::name:
+            component.setName(properties.get<Schema::name>());
+            break;
+        case Schema::title:
+            component.setTitle(properties.get<Schema::title>());
+            break;
+        case Schema::id:
+            component.setComponentID(properties.get<Schema::id>().toString());
+            break;
+        case Schema::description:
+            component.setDescription(properties.get<Schema::description>());
+            break;
+        case Schema::tooltip:
+            component.setHelpText(properties.get<Schema::tooltip>());
+            break;
+        case Schema::enabled:
+            component.setEnabled(properties.get<Schema::enabled>());
+            break;
+        case Schema::accessible:
+            component.setAccessible(properties.get<Schema::accessible>());
+            break;
+        case Schema::visibility:
+            component.setVisible(properties.get<Schema::visibility>());
+            break;
+        case Schema::alwaysOnTop:
+            component.setAlwaysOnTop(properties.get<Schema::alwaysOnTop>());
+            break;
+        case Schema::bufferedToImage:
+            component.setBufferedToImage(properties.get<Schema::bufferedToImage>());
+            break;
+        case Schema::opaque:
+            component.setOpaque(properties.get<Schema::opaque>());
+            break;
+        case Schema::focusable:
+            component.setWantsKeyboardFocus(properties.get<Schema::focusable>());
+            break;
+        case Schema::clickingGrabsFocus:
+            component.setMouseClickGrabsKeyboardFocus(properties.get<Schema::clickingGrabsFocus>());
+            break;
+        case Schema::focusOutline:
+            component.setHasFocusOutline(properties.get<Schema::focusOutline>());
+            break;
+        case Schema::focusOrder:
+            component.setExplicitFocusOrder(properties.get<Schema::focusOrder>());
+            break;
+        case Schema::cursor:
+            component.setMouseCursor(juce::MouseCursor{ properties.get<Schema::cursor>() });
+            break;
+        case Schema::display:
+        default:
+            break;
+        }
+    }
 } // namespace jive
 
 #if JIVE_UNIT_TESTS
@@ -27,27 +27,68 @@ namespace jive
         void childrenChanged() override;
 
     private:
+        struct Schema
+        {
+            enum Slot
+            {
+                name,
+                title,
+                id,
+                description,
+                tooltip,
+                enabled,
+                accessible,
+                visibility,
+                alwaysOnTop,
+                bufferedToImage,
+                opaque,
+                focusable,
+                clickingGrabsFocus,
+                focusOutline,
+                focusOrder,
+                cursor,
+                display,
+            };
+
+            static constexpr auto entries = std::make_tuple(
+                PropertySchemaEntry<juce::String>{ "name" },
+                PropertySchemaEntry<juce::String>{ "title" },
+                PropertySchemaEntry<juce::Identifier>{ "id" },
+                PropertySchemaEntry<juce::String>{ "description" },
+                PropertySchemaEntry<juce::String>{ "tooltip" },
+                PropertySchemaEntry<bool>{ "enabled", [] {
+                                              return true;
+                                          } },
+                PropertySchemaEntry<bool>{ "accessible", [] {
+                                              return true;
+                                          } },
+                PropertySchemaEntry<bool>{ "visibility", [] {
+                                              return true;
+                                          } },
+                PropertySchemaEntry<bool>{ "always-on-top" },
+                PropertySchemaEntry<bool>{ "buffered-to-image" },
+                PropertySchemaEntry<bool>{ "opaque" },
+                PropertySchemaEntry<bool>{ "focusable" },
+                PropertySchemaEntry<bool>{ "clicking-grabs-focus", [] {
+                                              return true;
+                                          } },
+                PropertySchemaEntry<bool>{ "focus-outline" },
+                PropertySchemaEntry<int>{ "focus-order" },
+                PropertySchemaEntry<juce::MouseCursor::StandardCursorType>{ "cursor", [] {
+                                                                               return juce::MouseCursor::NormalCursor;
+                                                                           } },
+                PropertySchemaEntry<Display>{ "display", [] {
+                                                 return Display::flex;
+                                             } });
+        };
+
+        void applyProperty(std::size_t slot);
+
 #if !JIVE_GUI_ITEMS_HAVE_STYLE_SHEETS
         ComponentInteractionState interactionState;
 #endif
-        Property<juce::String> name;
-        Property<juce::String> title;
-        Property<juce::Identifier> id;
-        Property<juce::String> description;
-        Property<juce::String> tooltip;
-        Property<bool> enabled;
-        Property<bool> accessible;
-        Property<bool> visibility;
-        Property<bool> alwaysOnTop;
-        Property<bool> bufferedToImage;
-        Property<bool> opaque;
-        Property<bool> focusable;
-        Property<bool> clickingGrabsFocus;
-        Property<bool> focusOutline;
-        Property<int> focusOrder;
+        PropertyTable<Schema> properties;
         Property<float> opacity;
-        Property<juce::MouseCursor::StandardCursorType> cursor;
-        Property<Display> display;
         Length width;
         Length height;
 
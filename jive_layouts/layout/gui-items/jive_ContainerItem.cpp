@@ -7,9 +7,16 @@ namespace jive
     ContainerItem::ContainerItem(std::unique_ptr<GuiItem> itemToDecorate)
         : GuiItemDecorator{ std::move(itemToDecorate) }
         , box{ boxModel(*this) }
-        , idealWidth{ state, "ideal-width" }
-        , idealHeight{ state, "ideal-height" }
+        , idealWidth{ BoxModel::getLayoutState(state), ids::idealWidth }
+        , idealHeight{ BoxModel::getLayoutState(state), ids::idealHeight }
     {
+        idealWidth.onValueChange = [this] {
+            idealSizeChanged();
+        };
+        idealHeight.onValueChange = [this] {
+            idealSizeChanged();
+        };
+
         box.addListener(*this);
     }
 
@@ -40,6 +47,19 @@ namespace jive
 
     void ContainerItem::updateIdealSizeUnrestrained()
     {
+        const auto isDeferred = ScopedUpdateBatch::defer(
+            state,
+            static_cast<GuiItem*>(this),
+            ids::idealSize,
+            [safeThis = juce::WeakReference<GuiItem>{ this }] {
+                if (auto* container = dynamic_cast<ContainerItem*>(safeThis.get()))
+                    container->updateIdealSizeUnrestrained();
+            },
+            ScopedUpdateBatch::Phase::layout);
+
+        if (isDeferred)
+            return;
+
         updateIdealSize({
             static_cast<float>(std::numeric_limits<juce::uint16>::max()),
             static_cast<float>(std::numeric_limits<juce::uint16>::max()),
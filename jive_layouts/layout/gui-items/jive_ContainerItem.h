@@ -62,6 +62,11 @@ namespace jive
     protected:
         virtual juce::Rectangle<float> calculateIdealSize(juce::Rectangle<float> constraints) const = 0;
 
+        /** Called when the ideal size of this container, or of any of its
+            children, changes.
+        */
+        virtual void idealSizeChanged() {}
+
     private:
         void updateIdealSize(juce::Rectangle<float> constraints);
 
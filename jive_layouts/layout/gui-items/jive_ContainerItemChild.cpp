@@ -9,11 +9,12 @@ namespace jive
     public:
         explicit Pimpl(jive::GuiItemDecorator& item)
             : state{ item.state }
-            , order{ state, "order" }
-            , width{ state, "width" }
-            , height{ state, "height" }
-            , idealWidth{ state, "ideal-width" }
-            , idealHeight{ state, "ideal-height" }
+            , layoutState{ BoxModel::getLayoutState(state) }
+            , order{ state, ids::order }
+            , width{ state, ids::width }
+            , height{ state, ids::height }
+            , idealWidth{ layoutState, ids::idealWidth }
+            , idealHeight{ layoutState, ids::idealHeight }
             , boxModel{ item.toType<CommonGuiItem>()->boxModel }
         {
         }
@@ -77,7 +78,7 @@ namespace jive
             }
             else if (idealHeight.exists())
             {
-                const auto property = state["ideal-height"];
+                const auto property = (*layoutState)[idealHeight.id];
 
                 if (const auto calculateHeight = property.getNativeFunction();
                     calculateHeight != nullptr)
@@ -114,7 +115,7 @@ namespace jive
             }
             else if (idealHeight.exists())
             {
-                const auto property = state["ideal-height"];
+                const auto property = (*layoutState)[idealHeight.id];
 
                 if (const auto calculateHeight = property.getNativeFunction();
                     calculateHeight != nullptr)
@@ -154,6 +155,7 @@ namespace jive
         }
 
         const juce::ValueTree state;
+        const Object::ReferenceCountedPointer layoutState;
         const Property<int> order;
         const Length width;
         const Length height;
@@ -165,9 +167,19 @@ namespace jive
     ContainerItem::Child::Child(std::unique_ptr<GuiItem> itemToDecorate)
         : GuiItemDecorator{ std::move(itemToDecorate) }
         , pimpl{ std::make_unique<Pimpl>(*this) }
-        , idealWidth{ state, "ideal-width" }
-        , idealHeight{ state, "ideal-height" }
+        , idealWidth{ BoxModel::getLayoutState(state), ids::idealWidth }
+        , idealHeight{ BoxModel::getLayoutState(state), ids::idealHeight }
     {
+        const auto notifyContainer = [this] {
+            if (auto* parent = dynamic_cast<GuiItemDecorator*>(getParent()))
+            {
+                if (auto* container = parent->getTopLevelDecorator().toType<ContainerItem>())
+                    container->idealSizeChanged();
+            }
+        };
+        idealWidth.onValueChange = notifyContainer;
+        idealHeight.onValueChange = notifyContainer;
+
         getComponent()->addComponentListener(this);
     }
 
@@ -10,22 +10,22 @@ namespace jive
 {
     Window::Window(std::unique_ptr<GuiItem> itemToDecorate)
         : GuiItemDecorator{ std::move(itemToDecorate) }
-        , hasShadow{ state, "shadow" }
-        , isNative{ state, "native" }
-        , isResizable{ state, "resizable" }
-        , useCornerResizer{ state, "corner-resizer" }
-        , minWidth{ state, "min-width" }
-        , minHeight{ state, "min-height" }
-        , maxWidth{ state, "max-width" }
-        , maxHeight{ state, "max-height" }
-        , isDraggable{ state, "draggable" }
-        , isFullScreen{ state, "full-screen" }
-        , isMinimised{ state, "minimised" }
-        , name{ state, "name" }
-        , titleBarHeight{ state, "title-bar-height" }
-        , titleBarButtons{ state, "title-bar-buttons" }
-        , width{ state, "width" }
-        , height{ state, "height" }
+        , hasShadow{ state, ids::shadow }
+        , isNative{ state, ids::native }
+        , isResizable{ state, ids::resizable }
+        , useCornerResizer{ state, ids::cornerResizer }
+        , minWidth{ state, ids::minWidth }
+        , minHeight{ state, ids::minHeight }
+        , maxWidth{ state, ids::maxWidth }
+        , maxHeight{ state, ids::maxHeight }
+        , isDraggable{ state, ids::draggable }
+        , isFullScreen{ state, ids::fullScreen }
+        , isMinimised{ state, ids::minimised }
+        , name{ state, ids::name }
+        , titleBarHeight{ state, ids::titleBarHeight }
+        , titleBarButtons{ state, ids::titleBarButtons }
+        , width{ state, ids::width }
+        , height{ state, ids::height }
     {
         const BoxModel::ScopedCallbackLock boxModelLock{ boxModel(*this) };
 
@@ -27,63 +27,19 @@ namespace jive
 
     Button::Button(std::unique_ptr<GuiItem> itemToDecorate)
         : GuiItemDecorator{ std::move(itemToDecorate) }
-        , toggleable{ state, "toggleable" }
-        , toggled{ state, "toggled" }
-        , toggleOnClick{ state, "toggle-on-click" }
-        , radioGroup{ state, "radio-group" }
-        , triggerEvent{ state, "trigger-event" }
-        , tooltip{ state, "tooltip" }
-        , text{ state, "text" }
-        , flexDirection{ state, "flex-direction" }
-        , justifyContent{ state, "justify-content" }
-        , padding{ state, "padding" }
-        , minWidth{ state, "min-width" }
-        , minHeight{ state, "min-height" }
-        , focusable{ state, "focusable" }
-        , onClick{ state, "on-click" }
+        , properties{ state }
+        , text{ state, ids::text }
+        , onClick{ state, ids::onClick }
     {
         const BoxModel::ScopedCallbackLock boxModelLock{ boxModel(*this) };
 
-        if (!triggerEvent.exists())
-            triggerEvent = TriggerEvent::mouseUp;
-        if (!padding.exists())
-            padding = juce::BorderSize{ 0.0f, 5.0f, 0.0f, 5.0f };
-        if (!minWidth.exists())
-            minWidth = 50.0f;
-        if (!minHeight.exists())
-            minHeight = 20.0f;
-        if (!focusable.exists())
-            focusable = true;
-
-        toggleable.onValueChange = [this]() {
-            getButton().setToggleable(toggleable);
+        properties.applyDefaults();
+        properties.onValueChange = [this](std::size_t slot) {
+            applyProperty(slot);
         };
-        getButton().setToggleable(toggleable);
 
-        toggled.onValueChange = [this]() {
-            getButton().setToggleState(toggled, juce::sendNotification);
-        };
-        getButton().setToggleState(toggled, juce::sendNotification);
-
-        toggleOnClick.onValueChange = [this]() {
-            getButton().setClickingTogglesState(toggleOnClick);
-        };
-        getButton().setClickingTogglesState(toggleOnClick);
-
-        radioGroup.onValueChange = [this]() {
-            getButton().setRadioGroupId(radioGroup);
-        };
-        getButton().setRadioGroupId(radioGroup);
-
-        triggerEvent.onValueChange = [this]() {
-            getButton().setTriggeredOnMouseDown(triggerEvent == TriggerEvent::mouseDown);
-        };
-        getButton().setTriggeredOnMouseDown(triggerEvent == TriggerEvent::mouseDown);
-
-        tooltip.onValueChange = [this]() {
-            getButton().setTooltip(tooltip);
-        };
-        getButton().setTooltip(tooltip);
+        for (std::size_t slot = 0; slot < PropertyTable<Schema>::numSlots; slot++)
+            applyProperty(slot);
 
         text.onValueChange = [this]() {
             getButton().setTitle(text);
@@ -127,7 +83,7 @@ namespace jive
     {
         jassertquiet(button == &getButton());
 
-        toggled = getButton().getToggleState();
+        properties.set<Schema::toggled>(getButton().getToggleState());
         onClick.triggerWithoutSelfCallback();
     }
 
@@ -135,33 +91,64 @@ namespace jive
     {
         jassertquiet(&comp == &getButton());
 
-        if (radioGroup.get() != 0)
+        if (properties.get<Schema::radioGroup>() != 0)
         {
             if (auto* parentComponent = getButton().getParentComponent())
-                toggled = findFirstChildButton(*parentComponent) == &getButton();
+                properties.set<Schema::toggled>(findFirstChildButton(*parentComponent) == &getButton());
+        }
+    }
+
+    void Button::applyProperty(std::size_t slot)
+    {
+        auto& button = getButton();
+
+        switch (slot)
+        {
+        case Schema::toggleable:
+            button.setToggleable(properties.get<Schema::toggleable>());
+            break;
+        case Schema::toggled:
+            button.setToggleState(properties.get<Schema::toggled>(), juce::sendNotification);
+            break;
+        case Schema::toggleOnClick:
+            button.setClickingTogglesState(properties.get<Schema::toggleOnClick>());
+            break;
+        case Schema::radioGroup:
+            button.setRadioGroupId(properties.get<Schema::radioGroup>());
+            break;
+        case Schema::triggerEvent:
+            button.setTriggeredOnMouseDown(properties.get<Schema::triggerEvent>() == TriggerEvent::mouseDown);
+            break;
+        case Schema::tooltip:
+            button.setTooltip(properties.get<Schema::tooltip>());
+            break;
+        case Schema::padding:
+        case Schema::minWidth:
+        case Schema::minHeight:
+        case Schema::focusable:
+        default:
+            break;
         }
     }
 } // namespace jive
 
 namespace juce
 {
-    const Array<var> VariantConverter<jive::Button::TriggerEvent>::options = {
+    const jive::EnumNames<jive::Button::TriggerEvent> VariantConverter<jive::Button::TriggerEvent>::names = {
         "mouse-up",
         "mouse-down",
     };
 
     jive::Button::TriggerEvent VariantConverter<jive::Button::TriggerEvent>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<jive::Button::TriggerEvent>(options.indexOf(v));
+        const auto value = names.find(v);
+        jassert(value.has_value());
+        return value.value_or(jive::Button::TriggerEvent{});
     }
 
     var VariantConverter<jive::Button::TriggerEvent>::toVar(const jive::Button::TriggerEvent& event)
     {
-        const auto index = static_cast<int>(event);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return names.toVar(event);
     }
 } // namespace juce
 
@@ -27,24 +27,52 @@ namespace jive
         const juce::Button& getButton() const;
 
     private:
+        struct Schema
+        {
+            enum Slot
+            {
+                toggleable,
+                toggled,
+                toggleOnClick,
+                radioGroup,
+                triggerEvent,
+                tooltip,
+                padding,
+                minWidth,
+                minHeight,
+                focusable,
+            };
+
+            static constexpr auto entries = std::make_tuple(
+                PropertySchemaEntry<bool>{ "toggleable" },
+                PropertySchemaEntry<bool>{ "toggled" },
+                PropertySchemaEntry<bool>{ "toggle-on-click" },
+                PropertySchemaEntry<int>{ "radio-group" },
+                PropertySchemaEntry<TriggerEvent>{ "trigger-event", [] {
+                                                      return TriggerEvent::mouseUp;
+                                                  } },
+                PropertySchemaEntry<juce::String>{ "tooltip" },
+                PropertySchemaEntry<juce::BorderSize<float>>{ "padding", [] {
+                                                                 return juce::BorderSize{ 0.0f, 5.0f, 0.0f, 5.0f };
+                                                             } },
+                PropertySchemaEntry<float>{ "min-width", [] {
+                                               return 50.0f;
+                                           } },
+                PropertySchemaEntry<float>{ "min-height", [] {
+                                               return 20.0f;
+                                           } },
+                PropertySchemaEntry<bool>{ "focusable", [] {
+                                              return true;
+                                          } });
+        };
+
         void buttonClicked(juce::Button* button) final;
         void componentParentHierarchyChanged(juce::Component& component) final;
 
-        void updateTriggerEvent();
+        void applyProperty(std::size_t slot);
 
-        Property<bool> toggleable;
-        Property<bool> toggled;
-        Property<bool> toggleOnClick;
-        Property<int> radioGroup;
-        Property<TriggerEvent> triggerEvent;
-        Property<juce::String> tooltip;
+        PropertyTable<Schema> properties;
         Property<juce::String, Inheritance::doNotInherit, Accumulation::accumulate> text;
-        Property<juce::FlexBox::Direction> flexDirection;
-        Property<juce::FlexBox::JustifyContent> justifyContent;
-        Property<juce::BorderSize<float>> padding;
-        Property<float> minWidth;
-        Property<float> minHeight;
-        Property<bool> focusable;
 
         Event onClick;
 
@@ -66,6 +94,6 @@ namespace juce
         static var toVar(const jive::Button::TriggerEvent& event);
 
     private:
-        static const Array<var> options;
+        static const jive::EnumNames<jive::Button::TriggerEvent> names;
     };
 } // namespace juce
@@ -7,9 +7,9 @@ namespace jive
         , comboBox{ box }
         , index{ itemIndex }
         , id{ index + 1 }
-        , text{ tree, "text" }
-        , enabled{ tree, "enabled" }
-        , selected{ tree, "selected" }
+        , text{ tree, ids::text }
+        , enabled{ tree, ids::enabled }
+        , selected{ tree, ids::selected }
     {
         comboBox.addItem(text, id);
 
@@ -49,7 +49,7 @@ namespace jive
 
     ComboBox::Header::Header(juce::ValueTree sourceTree, ComboBox& box)
         : comboBox{ box }
-        , text{ sourceTree, "text" }
+        , text{ sourceTree, ids::text }
     {
         box.getComboBox().addSectionHeading(text);
 
@@ -60,13 +60,13 @@ namespace jive
 
     ComboBox::ComboBox(std::unique_ptr<GuiItem> itemToDecorate)
         : GuiItemDecorator(std::move(itemToDecorate))
-        , editable{ state, "editable" }
-        , tooltip{ state, "tooltip" }
-        , selected{ state, "selected" }
-        , width{ state, "width" }
-        , height{ state, "height" }
-        , focusable{ state, "focusable" }
-        , onChange{ state, "on-change" }
+        , editable{ state, ids::editable }
+        , tooltip{ state, ids::tooltip }
+        , selected{ state, ids::selected }
+        , width{ state, ids::width }
+        , height{ state, ids::height }
+        , focusable{ state, ids::focusable }
+        , onChange{ state, ids::onChange }
     {
         const BoxModel::ScopedCallbackLock boxModelLock{ boxModel(*this) };
 
@@ -86,10 +86,10 @@ namespace jive
         selected.onValueChange = [this]() {
             getComboBox().setSelectedItemIndex(selected);
 
-            auto currentlySelectedOption = state.getChildWithProperty("selected", true);
+            auto currentlySelectedOption = state.getChildWithProperty(ids::selected, true);
 
             if (currentlySelectedOption.isValid())
-                currentlySelectedOption.setProperty("selected", false, nullptr);
+                currentlySelectedOption.setProperty(ids::selected, false, nullptr);
 
             if (selected < options.size())
             {
@@ -11,56 +11,21 @@ namespace jive
 
     Slider::Slider(std::unique_ptr<GuiItem> itemToDecorate, float defaultWidth, float defaultHeight)
         : GuiItemDecorator{ std::move(itemToDecorate) }
-        , value{ state, "value" }
-        , min{ state, "min" }
-        , max{ state, "max" }
-        , mid{ state, "mid" }
-        , interval{ state, "interval" }
-        , orientation{ state, "orientation" }
-        , width{ state, "width" }
-        , height{ state, "height" }
-        , sensitivity{ state, "sensitivity" }
-        , isInVelocityMode{ state, "velocity-mode" }
-        , velocitySensitivity{ state, "velocity-sensitivity" }
-        , velocityThreshold{ state, "velocity-threshold" }
-        , velocityOffset{ state, "velocity-offset" }
-        , snapToMouse{ state, "snap-to-mouse" }
-        , focusable{ state, "focusable" }
-        , onChange{ state, "on-change" }
+        , properties{ state }
+        , orientation{ state, ids::orientation }
+        , width{ state, ids::width }
+        , height{ state, ids::height }
+        , onChange{ state, ids::onChange }
     {
         const BoxModel::ScopedCallbackLock boxModelLock{ boxModel(*this) };
 
-        if (!max.exists())
-            max = "1.0";
-        if (!sensitivity.exists())
-            sensitivity = 1.0;
-        if (!velocitySensitivity.exists())
-            velocitySensitivity = 1.0;
-        if (!velocityThreshold.exists())
-            velocityThreshold = 1;
-        if (!snapToMouse.exists())
-            snapToMouse = true;
-        if (!focusable.exists())
-            focusable = true;
-
-        min.onValueChange = [this]() {
-            updateRange();
-        };
-        max.onValueChange = [this]() {
-            updateRange();
-        };
-        mid.onValueChange = [this]() {
-            updateRange();
-        };
-        interval.onValueChange = [this]() {
-            updateRange();
+        properties.applyDefaults();
+        properties.onValueChange = [this](std::size_t slot) {
+            applyProperty(slot);
         };
-        updateRange();
 
-        value.onValueChange = [this]() {
-            getSlider().setValue(getSlider().getValueFromText(value));
-        };
-        getSlider().setValue(getSlider().getValueFromText(value));
+        updateRange();
+        applyProperty(Schema::value);
 
         orientation.onValueChange = [this]() {
             updateStyle();
@@ -73,31 +38,10 @@ namespace jive
         };
         updateStyle();
 
-        sensitivity.onValueChange = [this]() {
-            getSlider().setMouseDragSensitivity(juce::roundToInt(250.0 / sensitivity));
-        };
-        getSlider().setMouseDragSensitivity(juce::roundToInt(250.0 / sensitivity));
-
-        isInVelocityMode.onValueChange = [this]() {
-            getSlider().setVelocityBasedMode(isInVelocityMode);
-        };
-        getSlider().setVelocityBasedMode(isInVelocityMode);
-
-        velocitySensitivity.onValueChange = [this]() {
-            getSlider().setVelocityModeParameters(velocitySensitivity, velocityThreshold, velocityOffset);
-        };
-        velocityThreshold.onValueChange = [this]() {
-            getSlider().setVelocityModeParameters(velocitySensitivity, velocityThreshold, velocityOffset);
-        };
-        velocityOffset.onValueChange = [this]() {
-            getSlider().setVelocityModeParameters(velocitySensitivity, velocityThreshold, velocityOffset);
-        };
-        getSlider().setVelocityModeParameters(velocitySensitivity, velocityThreshold, velocityOffset);
-
-        snapToMouse.onValueChange = [this]() {
-            getSlider().setSliderSnapsToMousePosition(snapToMouse);
-        };
-        getSlider().setSliderSnapsToMousePosition(snapToMouse);
+        applyProperty(Schema::sensitivity);
+        applyProperty(Schema::velocityMode);
+        applyProperty(Schema::velocitySensitivity);
+        applyProperty(Schema::snapToMouse);
 
         getSlider().setTextBoxStyle(juce::Slider::NoTextBox, true, 0, 0);
         getSlider().addListener(this);
@@ -159,7 +103,7 @@ namespace jive
         if (slider != &getSlider())
             return;
 
-        value = getSlider().getTextFromValue(getSlider().getValue());
+        properties.set<Schema::value>(getSlider().getTextFromValue(getSlider().getValue()));
         onChange.triggerWithoutSelfCallback();
     }
 
@@ -177,16 +121,53 @@ namespace jive
         return {};
     }
 
+    void Slider::applyProperty(std::size_t slot)
+    {
+        auto& slider = getSlider();
+
+        switch (slot)
+        {
+        case Schema::value:
+            slider.setValue(slider.getValueFromText(properties.get<Schema::value>()));
+            break;
+        case Schema::min:
+        case Schema::max:
+        case Schema::mid:
+        case Schema::interval:
+            updateRange();
+            break;
+        case Schema::sensitivity:
+            slider.setMouseDragSensitivity(juce::roundToInt(250.0 / properties.get<Schema::sensitivity>()));
+            break;
+        case Schema::velocityMode:
+            slider.setVelocityBasedMode(properties.get<Schema::velocityMode>());
+            break;
+        case Schema::velocitySensitivity:
+        case Schema::velocityThreshold:
+        case Schema::velocityOffset:
+            slider.setVelocityModeParameters(properties.get<Schema::velocitySensitivity>(),
+                                             properties.get<Schema::velocityThreshold>(),
+                                             properties.get<Schema::velocityOffset>());
+            break;
+        case Schema::snapToMouse:
+            slider.setSliderSnapsToMousePosition(properties.get<Schema::snapToMouse>());
+            break;
+        case Schema::focusable:
+        default:
+            break;
+        }
+    }
+
     void Slider::updateRange()
     {
         auto& slider = getSlider();
-        juce::NormalisableRange<double> range{ slider.getValueFromText(min),
-                                               slider.getValueFromText(max) };
+        juce::NormalisableRange<double> range{ slider.getValueFromText(properties.get<Schema::min>()),
+                                               slider.getValueFromText(properties.get<Schema::max>()) };
 
-        if (mid.exists())
-            range.setSkewForCentre(slider.getValueFromText(mid));
-        if (interval.exists())
-            range.interval = slider.getValueFromText(interval);
+        if (properties.exists<Schema::mid>())
+            range.setSkewForCentre(slider.getValueFromText(properties.get<Schema::mid>()));
+        if (properties.exists<Schema::interval>())
+            range.interval = slider.getValueFromText(properties.get<Schema::interval>());
 
         slider.setNormalisableRange(range);
     }
@@ -26,27 +26,62 @@ namespace jive
         void updateStyle();
 
     private:
+        struct Schema
+        {
+            enum Slot
+            {
+                value,
+                min,
+                max,
+                mid,
+                interval,
+                sensitivity,
+                velocityMode,
+                velocitySensitivity,
+                velocityThreshold,
+                velocityOffset,
+                snapToMouse,
+                focusable,
+            };
+
+            static constexpr auto entries = std::make_tuple(
+                PropertySchemaEntry<juce::String>{ "value" },
+                PropertySchemaEntry<juce::String>{ "min" },
+                PropertySchemaEntry<juce::String>{ "max", [] {
+                                                      return juce::String{ "1.0" };
+                                                  } },
+                PropertySchemaEntry<juce::String>{ "mid" },
+                PropertySchemaEntry<juce::String>{ "interval" },
+                PropertySchemaEntry<double>{ "sensitivity", [] {
+                                                return 1.0;
+                                            } },
+                PropertySchemaEntry<bool>{ "velocity-mode" },
+                PropertySchemaEntry<double>{ "velocity-sensitivity", [] {
+                                                return 1.0;
+                                            } },
+                PropertySchemaEntry<int>{ "velocity-threshold", [] {
+                                             return 1;
+                                         } },
+                PropertySchemaEntry<double>{ "velocity-offset" },
+                PropertySchemaEntry<bool>{ "snap-to-mouse", [] {
+                                              return true;
+                                          } },
+                PropertySchemaEntry<bool>{ "focusable", [] {
+                                              return true;
+                                          } });
+        };
+
         void sliderValueChanged(juce::Slider* slider) override;
 
         virtual juce::Slider::SliderStyle getStyleForOrientation(Orientation orientation);
 
+        void applyProperty(std::size_t slot);
         void updateRange();
 
-        Property<juce::String> value;
-        Property<juce::String> min;
-        Property<juce::String> max;
-        Property<juce::String> mid;
-        Property<juce::String> interval;
+        PropertyTable<Schema> properties;
         Property<Orientation> orientation;
         Length width;
         Length height;
-        Property<double> sensitivity;
-        Property<bool> isInVelocityMode;
-        Property<double> velocitySensitivity;
-        Property<int> velocityThreshold;
-        Property<double> velocityOffset;
-        Property<bool> snapToMouse;
-        Property<bool> focusable;
 
         Event onChange;
 
@@ -109,7 +109,7 @@ namespace jive
 
     static std::unique_ptr<GuiItem> decorateWithDisplayBehaviour(std::unique_ptr<GuiItem> item)
     {
-        Property<Display> display{ item->state, "display" };
+        Property<Display> display{ item->state, ids::display };
 
         switch (display.get())
         {
@@ -131,7 +131,7 @@ namespace jive
         if (item->getParent() == nullptr)
             return item;
 
-        Property<Display> display{ item->state.getParent(), "display" };
+        Property<Display> display{ item->state.getParent(), ids::display };
 
         switch (display.get())
         {
@@ -283,7 +283,11 @@ namespace jive
             return std::make_unique<GuiItem>(std::move(component),
                                              expandedTree,
 #if JIVE_GUI_ITEMS_HAVE_STYLE_SHEETS
-                                             StyleSheet::create(*component, expandedTree),
+                                             StyleSheet::create(*component,
+                                                                expandedTree,
+                                                                parent != nullptr
+                                                                    ? StyleSheet::findFor(*parent->getComponent())
+                                                                    : nullptr),
 #endif
                                              parent);
         }
@@ -323,7 +327,7 @@ namespace jive
 
     std::unique_ptr<juce::Component> Interpreter::createComponent(const juce::ValueTree& tree, const GuiItem* parent) const
     {
-        if (auto* viewObject = dynamic_cast<jive::View*>(tree["view-object"].getObject()))
+        if (auto* viewObject = dynamic_cast<jive::View*>(tree[ids::viewObject].getObject()))
         {
             if (auto component = viewObject->createComponent(tree))
                 return component;
@@ -1,19 +1,8 @@
 #pragma once
 
-#include <juce_gui_basics/juce_gui_basics.h>
+#include <jive_core/values/jive_IdentifierHash.h>
 
-namespace std
-{
-    template <>
-    class hash<juce::Identifier>
-    {
-    public:
-        std::size_t operator()(const juce::Identifier& id) const
-        {
-            return id.toString().hash();
-        }
-    };
-} // namespace std
+#include <juce_gui_basics/juce_gui_basics.h>
 
 namespace jive
 {
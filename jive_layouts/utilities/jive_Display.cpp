@@ -2,7 +2,7 @@
 
 namespace juce
 {
-    const Array<var> VariantConverter<jive::Display>::options = {
+    const jive::EnumNames<jive::Display> VariantConverter<jive::Display>::names = {
         "flex",
         "grid",
         "block"
@@ -10,15 +10,13 @@ namespace juce
 
     jive::Display VariantConverter<jive::Display>::fromVar(const var& v)
     {
-        jassert(options.contains(v));
-        return static_cast<jive::Display>(options.indexOf(v));
+        const auto value = names.find(v);
+        jassert(value.has_value());
+        return value.value_or(jive::Display{});
     }
 
     var VariantConverter<jive::Display>::toVar(jive::Display display)
     {
-        const auto index = static_cast<int>(display);
-
-        jassert(options.size() >= index);
-        return options[index];
+        return names.toVar(display);
     }
 } // namespace juce
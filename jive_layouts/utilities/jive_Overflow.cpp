@@ -2,7 +2,7 @@
 
 namespace juce
 {
-    const std::unordered_map<jive::Overflow, String> VariantConverter<jive::Overflow>::stringsMap = {
+    const jive::EnumNames<jive::Overflow> VariantConverter<jive::Overflow>::names = {
         { jive::Overflow::hidden, "hidden" },
         { jive::Overflow::scroll, "scroll" },
     };
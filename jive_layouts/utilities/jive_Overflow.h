@@ -1,5 +1,7 @@
 #pragma once
 
+#include <jive_core/values/variant-converters/jive_EnumNames.h>
+
 #include <juce_data_structures/juce_data_structures.h>
 
 namespace jive
@@ -19,23 +21,18 @@ namespace juce
     public:
         static var toVar(const jive::Overflow& overflow)
         {
-            jassert(stringsMap.count(overflow) == 1);
-            return stringsMap.at(overflow);
+            return names.toVar(overflow);
         }
 
         static jive::Overflow fromVar(const var& v)
         {
-            auto overflowStringPair = std::find_if(std::begin(stringsMap),
-                                                   std::end(stringsMap),
-                                                   [v](const auto& pair) {
-                                                       return pair.second == v.toString();
-                                                   });
-            jassert(overflowStringPair != std::end(stringsMap));
+            const auto overflow = names.find(v);
+            jassert(overflow.has_value());
 
-            return overflowStringPair->first;
+            return overflow.value_or(jive::Overflow::hidden);
         }
 
     private:
-        static const std::unordered_map<jive::Overflow, String> stringsMap;
+        static const jive::EnumNames<jive::Overflow> names;
     };
 } // namespace juce
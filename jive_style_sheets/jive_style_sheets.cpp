@@ -1,3 +1,5 @@
 #include "jive_style_sheets.h"
 
+#include "style-sheets/jive_StyleIndex.cpp"
+#include "style-sheets/jive_StyleRules.cpp"
 #include "style-sheets/jive_StyleSheet.cpp"
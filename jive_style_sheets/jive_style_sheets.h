@@ -13,4 +13,6 @@ END_JUCE_MODULE_DECLARATION */
 #include <jive_components/jive_components.h>
 
 #include "style-sheets/jive_StyleIdentifier.h"
+#include "style-sheets/jive_StyleIndex.h"
+#include "style-sheets/jive_StyleRules.h"
 #include "style-sheets/jive_StyleSheet.h"
@@ -14,7 +14,8 @@ namespace jive
                 && enabled == other.enabled
                 && keyboard == other.keyboard
                 && mouse == other.mouse
-                && toggled == other.toggled;
+                && toggled == other.toggled
+                && fromAncestor == other.fromAncestor;
         }
 
         juce::String id;
@@ -24,6 +25,11 @@ namespace jive
         ComponentInteractionState::Keyboard keyboard;
         ComponentInteractionState::Mouse mouse;
         bool toggled = false;
+
+        /** True for styles declared by one of the element's ancestors rather
+            than in its own style.
+        */
+        bool fromAncestor = false;
     };
 } // namespace jive
 
@@ -40,7 +46,8 @@ namespace std
                     + juce::String{ styleID.enabled ? "enabled" : "disabled" }
                     + juce::String{ static_cast<int>(styleID.keyboard) }
                     + juce::String{ static_cast<int>(styleID.mouse) }
-                    + juce::String{ styleID.toggled ? "checked" : "unchecked" })
+                    + juce::String{ styleID.toggled ? "checked" : "unchecked" }
+                    + juce::String{ styleID.fromAncestor ? "ancestor" : "own" })
                 .hash();
         }
     };
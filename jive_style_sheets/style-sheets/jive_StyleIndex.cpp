@@ -0,0 +1,295 @@
+#include "jive_StyleIndex.h"
+
+namespace jive
+{
+    static auto& getSharedIndices()
+    {
+        static std::unordered_map<const Object*, StyleIndex*> sharedIndices;
+        return sharedIndices;
+    }
+
+    // Properties whose values can be objects without them being selectors.
+    [[nodiscard]] static bool isSelector(const juce::Identifier& name)
+    {
+        static const std::array<juce::Identifier, 8> nonSelectors{
+            ids::background,
+            ids::foreground,
+            ids::border,
+            "hover",
+            "active",
+            "focus",
+            "disabled",
+            "checked",
+        };
+
+        return std::find(std::begin(nonSelectors), std::end(nonSelectors), name) == std::end(nonSelectors);
+    }
+
+    StyleIndex::StyleIndex(Object::ReferenceCountedPointer styleToIndex)
+        : style{ std::move(styleToIndex) }
+    {
+        jassert(style != nullptr);
+
+        for (const auto& property : style->getProperties())
+            index(property.name);
+
+        style->addListener(*this);
+    }
+
+    StyleIndex::~StyleIndex()
+    {
+        style->removeListener(*this);
+
+        auto& sharedIndices = getSharedIndices();
+
+        if (const auto entry = sharedIndices.find(style.get());
+            entry != std::end(sharedIndices) && entry->second == this)
+        {
+            sharedIndices.erase(entry);
+        }
+    }
+
+    StyleIndex::ReferenceCountedPointer StyleIndex::getFor(const Object::ReferenceCountedPointer& style)
+    {
+        jassert(style != nullptr);
+        auto& sharedIndices = getSharedIndices();
+
+        if (const auto entry = sharedIndices.find(style.get());
+            entry != std::end(sharedIndices))
+        {
+            return entry->second;
+        }
+
+        ReferenceCountedPointer index = new StyleIndex{ style };
+        sharedIndices.emplace(style.get(), index.get());
+        return index;
+    }
+
+    int StyleIndex::getNumSharedIndices()
+    {
+        return static_cast<int>(std::size(getSharedIndices()));
+    }
+
+    bool StyleIndex::isEmpty() const noexcept
+    {
+        return std::empty(typeRules) && std::empty(classRules) && std::empty(idRules);
+    }
+
+    [[nodiscard]] static Object* findRules(const std::unordered_map<juce::String, Object::ReferenceCountedPointer>& rules,
+                                           const juce::String& selector)
+    {
+        if (const auto entry = rules.find(selector);
+            entry != std::end(rules))
+        {
+            return entry->second.get();
+        }
+
+        return nullptr;
+    }
+
+    Object* StyleIndex::findTypeRules(const juce::String& type) const
+    {
+        return findRules(typeRules, type);
+    }
+
+    Object* StyleIndex::findClassRules(const juce::String& className) const
+    {
+        return findRules(classRules, className);
+    }
+
+    Object* StyleIndex::findIdRules(const juce::String& id) const
+    {
+        return findRules(idRules, id);
+    }
+
+    void StyleIndex::addListener(Listener& listener)
+    {
+        listeners.addIfNotAlreadyThere(&listener);
+    }
+
+    void StyleIndex::removeListener(Listener& listener)
+    {
+        listeners.removeFirstMatchingValue(&listener);
+    }
+
+    void StyleIndex::propertyChanged(Object&, const juce::Identifier&)
+    {
+    }
+
+    void StyleIndex::keyPathChanged(Object&, const Object::KeyPath& path)
+    {
+        // Changes within a nested object are picked up by the Properties
+        // reading them, but they can't notice the object itself changing.
+        if (path.size() != 1)
+            return;
+
+        const auto& propertyName = path.getReference(0);
+        const auto wasObject = unindex(propertyName);
+        const auto isObject = index(propertyName);
+
+        if (!wasObject && !isObject)
+            return;
+
+        const ReferenceCountedPointer keepAlive{ this };
+
+        // Listeners may rebuild themselves in response, adding new listeners
+        // and removing old ones.
+        const auto listenersToCall = listeners;
+
+        for (auto* listener : listenersToCall)
+        {
+            if (listeners.contains(listener))
+                listener->topLevelObjectChanged(*this, propertyName);
+        }
+    }
+
+    bool StyleIndex::unindex(const juce::Identifier& propertyName)
+    {
+        if (topLevelObjects.erase(propertyName) == 0)
+            return false;
+
+        const auto selector = propertyName.toString();
+
+        if (selector.startsWithChar('.'))
+            classRules.erase(selector.substring(1));
+        else if (selector.startsWithChar('#'))
+            idRules.erase(selector.substring(1));
+        else
+            typeRules.erase(selector);
+
+        return true;
+    }
+
+    bool StyleIndex::index(const juce::Identifier& propertyName)
+    {
+        auto* rules = dynamic_cast<Object*>((*style)[propertyName].getObject());
+
+        if (rules == nullptr)
+            return false;
+
+        topLevelObjects.insert(propertyName);
+
+        if (!isSelector(propertyName))
+            return true;
+
+        const auto selector = propertyName.toString();
+
+        if (selector.startsWithChar('.'))
+            classRules[selector.substring(1)] = rules;
+        else if (selector.startsWithChar('#'))
+            idRules[selector.substring(1)] = rules;
+        else
+            typeRules[selector] = rules;
+
+        return true;
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class StyleIndexTest : public juce::UnitTest
+{
+public:
+    StyleIndexTest()
+        : juce::UnitTest{ "jive::StyleIndex", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testIndexing();
+        testUpdating();
+        testSharing();
+    }
+
+private:
+    void testIndexing()
+    {
+        beginTest("indexing");
+
+        const jive::Object::ReferenceCountedPointer button = new jive::Object{ { "background", "#111111" } };
+        const jive::Object::ReferenceCountedPointer primary = new jive::Object{ { "background", "#222222" } };
+        const jive::Object::ReferenceCountedPointer save = new jive::Object{ { "background", "#333333" } };
+        const jive::Object::ReferenceCountedPointer style = new jive::Object{
+            { "foreground", "#000000" },
+            { "background", new jive::Object{ { "gradient", "linear" } } },
+            { "hover", new jive::Object{ { "background", "#444444" } } },
+            { "Button", button.get() },
+            { ".primary", primary.get() },
+            { "#save", save.get() },
+        };
+        const auto index = jive::StyleIndex::getFor(style);
+        expect(!index->isEmpty());
+        expect(index->findTypeRules("Button") == button.get());
+        expect(index->findClassRules("primary") == primary.get());
+        expect(index->findIdRules("save") == save.get());
+        expect(index->findTypeRules("hover") == nullptr);
+        expect(index->findTypeRules("background") == nullptr);
+        expect(index->findTypeRules("Label") == nullptr);
+        expect(index->findClassRules("Button") == nullptr);
+
+        expect(jive::StyleIndex::getFor(new jive::Object{ { "background", "#111111" } })->isEmpty());
+    }
+
+    void testUpdating()
+    {
+        beginTest("updating");
+
+        struct Listener : jive::StyleIndex::Listener
+        {
+            void topLevelObjectChanged(jive::StyleIndex&, const juce::Identifier& propertyName) final
+            {
+                changes.add(propertyName.toString());
+            }
+
+            juce::StringArray changes;
+        };
+
+        const jive::Object::ReferenceCountedPointer style = new jive::Object{
+            { "Button", new jive::Object{ { "background", "#111111" } } },
+        };
+        const auto index = jive::StyleIndex::getFor(style);
+        Listener listener;
+        index->addListener(listener);
+
+        const jive::Object::ReferenceCountedPointer primary = new jive::Object{ { "background", "#222222" } };
+        style->setProperty(".primary", primary.get());
+        expect(index->findClassRules("primary") == primary.get());
+        expect(listener.changes == juce::StringArray{ ".primary" });
+
+        const jive::Object::ReferenceCountedPointer button = new jive::Object{ { "background", "#333333" } };
+        style->setProperty("Button", button.get());
+        expect(index->findTypeRules("Button") == button.get());
+
+        style->removeProperty("Button");
+        expect(index->findTypeRules("Button") == nullptr);
+        expect(listener.changes == juce::StringArray{ ".primary", "Button", "Button" });
+
+        style->setProperty("foreground", "#444444");
+        button->setProperty("background", "#555555");
+        expectEquals(listener.changes.size(), 3);
+
+        index->removeListener(listener);
+    }
+
+    void testSharing()
+    {
+        beginTest("sharing");
+
+        const auto numSharedIndicesBefore = jive::StyleIndex::getNumSharedIndices();
+        const jive::Object::ReferenceCountedPointer style = new jive::Object{
+            { "Button", new jive::Object{ { "background", "#111111" } } },
+        };
+
+        {
+            const auto index1 = jive::StyleIndex::getFor(style);
+            const auto index2 = jive::StyleIndex::getFor(style);
+            expect(index1 == index2);
+            expectEquals(jive::StyleIndex::getNumSharedIndices(), numSharedIndicesBefore + 1);
+        }
+
+        expectEquals(jive::StyleIndex::getNumSharedIndices(), numSharedIndicesBefore);
+    }
+};
+
+static StyleIndexTest styleIndexTest;
+#endif
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <jive_core/jive_core.h>
+
+namespace jive
+{
+    /** The type, class and id selectors at the top level of a style object,
+        indexed so that the descendants of the element the style belongs to
+        can find the rules that apply to them without walking the object.
+
+        There's only ever one index for a given style object, shared by
+        everything that looks it up, so a style that themes a whole document
+        is only indexed once. The index follows the style as objects are
+        added to, replaced in or removed from its top level.
+    */
+    class StyleIndex
+        : public juce::ReferenceCountedObject
+        , private Object::Listener
+    {
+    public:
+        using ReferenceCountedPointer = juce::ReferenceCountedObjectPtr<StyleIndex>;
+
+        struct Listener
+        {
+            virtual ~Listener() = default;
+
+            /** Called when an object at the top level of the style - a
+                selector, or a state such as "hover" - is added, replaced or
+                removed.
+            */
+            virtual void topLevelObjectChanged(StyleIndex& index, const juce::Identifier& propertyName) = 0;
+        };
+
+        ~StyleIndex() override;
+
+        /** Returns the index of the given style, indexing it if it hasn't
+            been already.
+        */
+        [[nodiscard]] static ReferenceCountedPointer getFor(const Object::ReferenceCountedPointer& style);
+
+        /** Returns the number of style objects currently indexed. */
+        [[nodiscard]] static int getNumSharedIndices();
+
+        [[nodiscard]] bool isEmpty() const noexcept;
+
+        [[nodiscard]] Object* findTypeRules(const juce::String& type) const;
+        [[nodiscard]] Object* findClassRules(const juce::String& className) const;
+        [[nodiscard]] Object* findIdRules(const juce::String& id) const;
+
+        void addListener(Listener& listener);
+        void removeListener(Listener& listener);
+
+    private:
+        explicit StyleIndex(Object::ReferenceCountedPointer styleToIndex);
+
+        void propertyChanged(Object& object, const juce::Identifier& propertyName) final;
+        void keyPathChanged(Object& object, const Object::KeyPath& path) final;
+
+        bool unindex(const juce::Identifier& propertyName);
+        bool index(const juce::Identifier& propertyName);
+
+        const Object::ReferenceCountedPointer style;
+        std::unordered_set<juce::Identifier> topLevelObjects;
+        juce::Array<Listener*> listeners;
+        std::unordered_map<juce::String, Object::ReferenceCountedPointer> typeRules;
+        std::unordered_map<juce::String, Object::ReferenceCountedPointer> classRules;
+        std::unordered_map<juce::String, Object::ReferenceCountedPointer> idRules;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StyleIndex)
+    };
+} // namespace jive
@@ -0,0 +1,469 @@
+#include "jive_StyleRules.h"
+
+namespace jive
+{
+    bool StyleRules::Key::operator==(const Key& other) const noexcept
+    {
+        return style == other.style
+            && type == other.type
+            && id == other.id
+            && classes == other.classes
+            && ancestorStyles == other.ancestorStyles;
+    }
+
+    std::size_t StyleRules::KeyHash::operator()(const Key& key) const noexcept
+    {
+        auto result = std::hash<const Object*>{}(key.style.get());
+        const auto combine = [&result](std::size_t hash) {
+            result ^= hash + 0x9e3779b9 + (result << 6) + (result >> 2);
+        };
+
+        combine(key.type.hash());
+        combine(key.id.hash());
+
+        for (const auto& className : key.classes)
+            combine(className.hash());
+
+        for (const auto& ancestorStyle : key.ancestorStyles)
+            combine(std::hash<const StyleIndex*>{}(ancestorStyle.get()));
+
+        return result;
+    }
+
+    static auto& getSharedRules()
+    {
+        static std::unordered_map<StyleRules::Key, StyleRules*, StyleRules::KeyHash> sharedRules;
+        return sharedRules;
+    }
+
+    template <typename PropertyType>
+    [[nodiscard]] static CompiledStyles<PropertyType> compile(const std::unordered_map<StyleIdentifier, PropertyType>& styles)
+    {
+        CompiledStyles<PropertyType> result;
+        result.reserve(std::size(styles));
+
+        for (const auto& [styleID, style] : styles)
+            result.emplace_back(CompiledStyleSelector{ styleID }, &style);
+
+        std::stable_sort(std::begin(result),
+                         std::end(result),
+                         [](const auto& first, const auto& second) {
+                             return first.first.specificity > second.first.specificity;
+                         });
+
+        return result;
+    }
+
+    // Only styles nested under the rules' own type, id and classes are ever
+    // added, so the interaction state is all that's left to check.
+    template <typename PropertyType>
+    [[nodiscard]] static const PropertyType* findStyle(const CompiledStyles<PropertyType>& styles,
+                                                       std::uint8_t interactionState)
+    {
+        for (const auto& [selector, style] : styles)
+        {
+            if ((selector.requirements & ~interactionState) == 0)
+                return style;
+        }
+
+        return nullptr;
+    }
+
+    StyleRules::StyleRules(Key rulesKey)
+        : key{ std::move(rulesKey) }
+        , ownStyleIndex{ key.style != nullptr ? StyleIndex::getFor(key.style) : nullptr }
+    {
+        jassert(key.style != nullptr || !key.ancestorStyles.isEmpty());
+
+        if (key.style != nullptr)
+            addStyles(*key.style, StyleIdentifier{});
+
+        for (const auto& ancestorStyle : key.ancestorStyles)
+            addAncestorStyles(*ancestorStyle);
+
+        const auto compileStyles = [](auto& styles) {
+            styles.compiled = compile(styles.properties);
+        };
+        compileStyles(backgroundStyles);
+        compileStyles(foregroundStyles);
+        compileStyles(borderFillStyles);
+        compileStyles(borderRadiiStyles);
+        compileStyles(fontFamilyStyles);
+        compileStyles(fontSizeStyles);
+        compileStyles(fontStretchStyles);
+        compileStyles(fontStyleStyles);
+        compileStyles(fontWeightStyles);
+        compileStyles(letterSpacingStyles);
+        compileStyles(textDecorationStyles);
+
+        if (ownStyleIndex != nullptr)
+            ownStyleIndex->addListener(*this);
+
+        for (const auto& ancestorStyle : key.ancestorStyles)
+            ancestorStyle->addListener(*this);
+    }
+
+    StyleRules::~StyleRules()
+    {
+        if (ownStyleIndex != nullptr)
+            ownStyleIndex->removeListener(*this);
+
+        for (const auto& ancestorStyle : key.ancestorStyles)
+            ancestorStyle->removeListener(*this);
+
+        retire();
+    }
+
+    StyleRules::ReferenceCountedPointer StyleRules::getFor(Key key)
+    {
+        auto& sharedRules = getSharedRules();
+
+        if (const auto entry = sharedRules.find(key);
+            entry != std::end(sharedRules))
+        {
+            return entry->second;
+        }
+
+        ReferenceCountedPointer rules = new StyleRules{ key };
+        sharedRules.emplace(std::move(key), rules.get());
+        return rules;
+    }
+
+    int StyleRules::getNumSharedRules()
+    {
+        return static_cast<int>(std::size(getSharedRules()));
+    }
+
+    const StyleRules::Resolution& StyleRules::resolve(std::uint8_t interactionState) const
+    {
+        auto& resolution = resolutions[interactionState];
+
+        if (!resolution.has_value())
+        {
+            resolution.emplace();
+            resolution->background = findStyle(backgroundStyles.compiled, interactionState);
+            resolution->foreground = findStyle(foregroundStyles.compiled, interactionState);
+            resolution->borderFill = findStyle(borderFillStyles.compiled, interactionState);
+            resolution->borderRadii = findStyle(borderRadiiStyles.compiled, interactionState);
+            resolution->fontFamily = findStyle(fontFamilyStyles.compiled, interactionState);
+            resolution->fontSize = findStyle(fontSizeStyles.compiled, interactionState);
+            resolution->fontStretch = findStyle(fontStretchStyles.compiled, interactionState);
+            resolution->fontStyle = findStyle(fontStyleStyles.compiled, interactionState);
+            resolution->fontWeight = findStyle(fontWeightStyles.compiled, interactionState);
+            resolution->letterSpacing = findStyle(letterSpacingStyles.compiled, interactionState);
+            resolution->textDecoration = findStyle(textDecorationStyles.compiled, interactionState);
+        }
+
+        return *resolution;
+    }
+
+    void StyleRules::addListener(Listener& listener)
+    {
+        listeners.add(&listener);
+    }
+
+    void StyleRules::removeListener(Listener& listener)
+    {
+        listeners.remove(&listener);
+    }
+
+    void StyleRules::addStyles(Object& source, StyleIdentifier styleID)
+    {
+        const auto appendStyle = [&](const auto& styleProperty, auto& styles) {
+            using PropertyType = typename std::remove_reference_t<decltype(styles)>::PropertyType;
+
+            if (source.hasProperty(styleProperty) && styles.properties.find(styleID) == std::end(styles.properties))
+            {
+                styles.properties.insert(std::make_pair(styleID, PropertyType{ &source, styleProperty }));
+                styles.properties.at(styleID).onValueChange = [this] {
+                    listeners.call(&Listener::styleValueChanged);
+                };
+                styles.properties.at(styleID).onTransitionProgressed = [this] {
+                    listeners.call(&Listener::styleTransitionProgressed);
+                };
+            }
+        };
+        appendStyle(ids::background, backgroundStyles);
+        appendStyle(ids::foreground, foregroundStyles);
+        appendStyle(ids::border, borderFillStyles);
+        appendStyle(ids::borderRadius, borderRadiiStyles);
+        appendStyle(ids::fontFamily, fontFamilyStyles);
+        appendStyle(ids::fontSize, fontSizeStyles);
+        appendStyle(ids::fontStretch, fontStretchStyles);
+        appendStyle(ids::fontStyle, fontStyleStyles);
+        appendStyle(ids::fontWeight, fontWeightStyles);
+        appendStyle(ids::letterSpacing, letterSpacingStyles);
+        appendStyle(ids::textDecoration, textDecorationStyles);
+
+        const auto appendNestedStyles = [&](const juce::String& property, auto&& updateNewID) {
+            if (property.isEmpty())
+                return;
+
+            if (auto* child = dynamic_cast<jive::Object*>(source[property].getObject()))
+            {
+                auto newID = styleID;
+                updateNewID(newID);
+
+                addStyles(*child, newID);
+            }
+        };
+
+        appendNestedStyles(key.id.isEmpty() ? juce::String{} : "#" + key.id,
+                           [&](auto& newID) {
+                               newID.id = key.id;
+                           });
+
+        for (const auto& className : key.classes)
+        {
+            appendNestedStyles("." + className,
+                               [&](auto& newID) {
+                                   newID.className = className;
+                               });
+        }
+
+        appendNestedStyles(key.type,
+                           [&](auto& newID) {
+                               newID.type = key.type;
+                           });
+        appendNestedStyles("disabled",
+                           [&](auto& newID) {
+                               newID.enabled = false;
+                           });
+        appendNestedStyles("focus",
+                           [&](auto& newID) {
+                               newID.keyboard = ComponentInteractionState::Keyboard::focus;
+                           });
+        appendNestedStyles("active",
+                           [&](auto& newID) {
+                               newID.mouse = ComponentInteractionState::Mouse::active;
+                           });
+        appendNestedStyles("hover",
+                           [&](auto& newID) {
+                               newID.mouse = ComponentInteractionState::Mouse::hover;
+                           });
+        appendNestedStyles("checked",
+                           [&](auto& newID) {
+                               newID.toggled = true;
+                           });
+    }
+
+    void StyleRules::topLevelObjectChanged(StyleIndex& index, const juce::Identifier& propertyName)
+    {
+        const auto selector = propertyName.toString();
+
+        // The interaction states only apply at the top level of a component's
+        // own style.
+        static const juce::StringArray states{ "disabled", "focus", "active", "hover", "checked" };
+        const auto isRelevant = dependsOnSelector(selector)
+                             || (&index == ownStyleIndex.get() && states.contains(selector));
+
+        if (!isRelevant)
+            return;
+
+        const ReferenceCountedPointer keepAlive{ this };
+        retire();
+        listeners.call(&Listener::styleRulesChanged);
+    }
+
+    bool StyleRules::dependsOnSelector(const juce::String& selector) const
+    {
+        if (selector.startsWithChar('#'))
+            return key.id.isNotEmpty() && selector.substring(1) == key.id;
+
+        if (selector.startsWithChar('.'))
+            return key.classes.contains(selector.substring(1));
+
+        return selector == key.type;
+    }
+
+    // Stops the rules being shared with anything that asks for rules with
+    // the same key from now on, so they're built afresh.
+    void StyleRules::retire()
+    {
+        auto& sharedRules = getSharedRules();
+
+        if (const auto entry = sharedRules.find(key);
+            entry != std::end(sharedRules) && entry->second == this)
+        {
+            sharedRules.erase(entry);
+        }
+    }
+
+    void StyleRules::addAncestorStyles(const StyleIndex& ancestorStyle)
+    {
+        StyleIdentifier inherited;
+        inherited.fromAncestor = true;
+
+        if (key.id.isNotEmpty())
+        {
+            if (auto* rules = ancestorStyle.findIdRules(key.id))
+            {
+                auto styleID = inherited;
+                styleID.id = key.id;
+                addStyles(*rules, styleID);
+            }
+        }
+
+        for (const auto& className : key.classes)
+        {
+            if (auto* rules = ancestorStyle.findClassRules(className))
+            {
+                auto styleID = inherited;
+                styleID.className = className;
+                addStyles(*rules, styleID);
+            }
+        }
+
+        if (auto* rules = ancestorStyle.findTypeRules(key.type))
+        {
+            auto styleID = inherited;
+            styleID.type = key.type;
+            addStyles(*rules, styleID);
+        }
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class StyleRulesTest : public juce::UnitTest
+{
+public:
+    StyleRulesTest()
+        : juce::UnitTest{ "jive::StyleRules", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testSharing();
+        testResolving();
+        testListening();
+    }
+
+private:
+    void testSharing()
+    {
+        beginTest("sharing");
+
+        const auto numSharedRulesBefore = jive::StyleRules::getNumSharedRules();
+        const jive::Object::ReferenceCountedPointer style = new jive::Object{
+            { "background", "#111111" },
+        };
+
+        {
+            const auto rules1 = jive::StyleRules::getFor({ style, "Button", "", { "primary" } });
+            const auto rules2 = jive::StyleRules::getFor({ style, "Button", "", { "primary" } });
+            expect(rules1 == rules2);
+            expectEquals(jive::StyleRules::getNumSharedRules(), numSharedRulesBefore + 1);
+
+            const auto rules3 = jive::StyleRules::getFor({ style, "Button", "", { "secondary" } });
+            const auto rules4 = jive::StyleRules::getFor({ style, "Label", "", { "primary" } });
+            const auto rules5 = jive::StyleRules::getFor({ style, "Button", "ok", { "primary" } });
+            const auto rules6 = jive::StyleRules::getFor({ new jive::Object{ *style }, "Button", "", { "primary" } });
+            expect(rules3 != rules1);
+            expect(rules4 != rules1);
+            expect(rules5 != rules1);
+            expect(rules6 != rules1);
+            expectEquals(jive::StyleRules::getNumSharedRules(), numSharedRulesBefore + 5);
+        }
+
+        expectEquals(jive::StyleRules::getNumSharedRules(), numSharedRulesBefore);
+    }
+
+    void testResolving()
+    {
+        beginTest("resolving");
+
+        const jive::Object::ReferenceCountedPointer style = new jive::Object{
+            { "background", "#111111" },
+            { "hover", new jive::Object{ { "background", "#222222" } } },
+            {
+                ".primary",
+                new jive::Object{
+                    { "foreground", "#333333" },
+                    { "checked", new jive::Object{ { "foreground", "#444444" } } },
+                },
+            },
+            { ".secondary", new jive::Object{ { "foreground", "#555555" } } },
+        };
+        const auto rules = jive::StyleRules::getFor({ style, "Button", "", { "primary" } });
+
+        const auto& normal = rules->resolve(0);
+        expect(normal.background != nullptr);
+        expectEquals(normal.background->get(), jive::Fill{ juce::Colour{ 0xFF111111 } });
+        expectEquals(normal.foreground->get(), jive::Fill{ juce::Colour{ 0xFF333333 } });
+        expect(normal.borderFill == nullptr);
+
+        const auto& hovered = rules->resolve(jive::CompiledStyleSelector::hover);
+        expectEquals(hovered.background->get(), jive::Fill{ juce::Colour{ 0xFF222222 } });
+
+        const auto& pressedAndChecked = rules->resolve(jive::CompiledStyleSelector::hover
+                                                       | jive::CompiledStyleSelector::active
+                                                       | jive::CompiledStyleSelector::toggled);
+        expectEquals(pressedAndChecked.background->get(), jive::Fill{ juce::Colour{ 0xFF222222 } });
+        expectEquals(pressedAndChecked.foreground->get(), jive::Fill{ juce::Colour{ 0xFF444444 } });
+    }
+
+    void testListening()
+    {
+        beginTest("listening");
+
+        struct Listener : jive::StyleRules::Listener
+        {
+            void styleValueChanged() final
+            {
+                numValueChanges++;
+            }
+
+            void styleTransitionProgressed() final
+            {
+            }
+
+            void styleRulesChanged() final
+            {
+                numRulesChanges++;
+            }
+
+            int numValueChanges = 0;
+            int numRulesChanges = 0;
+        };
+
+        const jive::Object::ReferenceCountedPointer hover = new jive::Object{
+            { "background", "#222222" },
+        };
+        const jive::Object::ReferenceCountedPointer style = new jive::Object{
+            { "background", "#111111" },
+            { "hover", hover.get() },
+        };
+        const auto rules = jive::StyleRules::getFor({ style, "Button", "", {} });
+
+        Listener listener1;
+        Listener listener2;
+        rules->addListener(listener1);
+        rules->addListener(listener2);
+
+        hover->setProperty("background", "#333333");
+        expectEquals(listener1.numValueChanges, 1);
+        expectEquals(listener2.numValueChanges, 1);
+        expectEquals(rules->resolve(jive::CompiledStyleSelector::hover).background->get(),
+                     jive::Fill{ juce::Colour{ 0xFF333333 } });
+
+        style->setProperty(".primary", new jive::Object{ { "background", "#444444" } });
+        expectEquals(listener1.numRulesChanges, 0);
+        expect(jive::StyleRules::getFor({ style, "Button", "", {} }) == rules);
+
+        style->setProperty("Button", new jive::Object{ { "border", "#555555" } });
+        expectEquals(listener1.numRulesChanges, 1);
+        expectEquals(listener2.numRulesChanges, 1);
+
+        const auto newRules = jive::StyleRules::getFor({ style, "Button", "", {} });
+        expect(newRules != rules);
+        expect(newRules->resolve(0).borderFill != nullptr);
+        expectEquals(newRules->resolve(0).borderFill->get(), jive::Fill{ juce::Colour{ 0xFF555555 } });
+
+        rules->removeListener(listener1);
+        rules->removeListener(listener2);
+    }
+};
+
+static StyleRulesTest styleRulesTest;
+#endif
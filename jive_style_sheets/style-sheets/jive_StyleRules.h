@@ -0,0 +1,131 @@
+#pragma once
+
+#include "jive_StyleIndex.h"
+#include "jive_StyleSelectors.h"
+
+namespace jive
+{
+    template <typename Value>
+    struct Styles
+    {
+        using PropertyType = Property<Value, Inheritance::doNotInherit, Accumulation::doNotAccumulate, false>;
+
+        std::unordered_map<StyleIdentifier, PropertyType> properties;
+        CompiledStyles<PropertyType> compiled;
+    };
+
+    /** The styles in a style object, and in the styles of a component's
+        ancestors, that can apply to components with a particular type, id and
+        set of classes.
+
+        Components with identical inputs share one set of rules, so the memory
+        they take up and the work of resolving them for each interaction state
+        grow with the number of distinct styles rather than the number of
+        components.
+
+        Changes to the values already in the rules are reported through
+        styleValueChanged(). If an object the rules depend on is added to,
+        replaced in or removed from the top level of one of the styles, the
+        rules are retired and their listeners told through
+        styleRulesChanged() to fetch a new set.
+    */
+    class StyleRules
+        : public juce::ReferenceCountedObject
+        , private StyleIndex::Listener
+    {
+    public:
+        using ReferenceCountedPointer = juce::ReferenceCountedObjectPtr<StyleRules>;
+
+        struct Key
+        {
+            [[nodiscard]] bool operator==(const Key& other) const noexcept;
+
+            Object::ReferenceCountedPointer style;
+            juce::String type;
+            juce::String id;
+            juce::StringArray classes;
+
+            /** The indexed styles of the component's ancestors, closest
+                first.
+            */
+            juce::Array<StyleIndex::ReferenceCountedPointer> ancestorStyles;
+        };
+
+        struct KeyHash
+        {
+            [[nodiscard]] std::size_t operator()(const Key& key) const noexcept;
+        };
+
+        /** The styles that win for each property in a particular interaction
+            state.
+        */
+        struct Resolution
+        {
+            const Styles<Fill>::PropertyType* background = nullptr;
+            const Styles<Fill>::PropertyType* foreground = nullptr;
+            const Styles<Fill>::PropertyType* borderFill = nullptr;
+            const Styles<BorderRadii<float>>::PropertyType* borderRadii = nullptr;
+            const Styles<juce::String>::PropertyType* fontFamily = nullptr;
+            const Styles<float>::PropertyType* fontSize = nullptr;
+            const Styles<float>::PropertyType* fontStretch = nullptr;
+            const Styles<juce::String>::PropertyType* fontStyle = nullptr;
+            const Styles<juce::String>::PropertyType* fontWeight = nullptr;
+            const Styles<float>::PropertyType* letterSpacing = nullptr;
+            const Styles<juce::String>::PropertyType* textDecoration = nullptr;
+        };
+
+        struct Listener
+        {
+            virtual ~Listener() = default;
+
+            virtual void styleValueChanged() = 0;
+            virtual void styleTransitionProgressed() = 0;
+            virtual void styleRulesChanged() = 0;
+        };
+
+        ~StyleRules() override;
+
+        /** Returns the rules shared by every component with the given inputs,
+            creating them if there aren't any yet.
+        */
+        [[nodiscard]] static ReferenceCountedPointer getFor(Key key);
+
+        /** Returns the number of distinct sets of rules currently in use. */
+        [[nodiscard]] static int getNumSharedRules();
+
+        [[nodiscard]] const Resolution& resolve(std::uint8_t interactionState) const;
+
+        void addListener(Listener& listener);
+        void removeListener(Listener& listener);
+
+    private:
+        explicit StyleRules(Key rulesKey);
+
+        void addStyles(Object& source, StyleIdentifier styleID);
+        void addAncestorStyles(const StyleIndex& ancestorStyle);
+
+        void topLevelObjectChanged(StyleIndex& index, const juce::Identifier& propertyName) final;
+        [[nodiscard]] bool dependsOnSelector(const juce::String& selector) const;
+        void retire();
+
+        const Key key;
+        const StyleIndex::ReferenceCountedPointer ownStyleIndex;
+
+        Styles<Fill> backgroundStyles;
+        Styles<Fill> foregroundStyles;
+        Styles<Fill> borderFillStyles;
+        Styles<BorderRadii<float>> borderRadiiStyles;
+        Styles<juce::String> fontFamilyStyles;
+        Styles<float> fontSizeStyles;
+        Styles<float> fontStretchStyles;
+        Styles<juce::String> fontStyleStyles;
+        Styles<juce::String> fontWeightStyles;
+        Styles<float> letterSpacingStyles;
+        Styles<juce::String> textDecorationStyles;
+
+        mutable std::array<std::optional<Resolution>, StyleSelectors::numStates> resolutions;
+        juce::ListenerList<Listener> listeners;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StyleRules)
+    };
+} // namespace jive
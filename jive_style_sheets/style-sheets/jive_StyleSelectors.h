@@ -6,107 +6,102 @@
 
 namespace jive
 {
+    /** A StyleIdentifier reduced to the interaction states it requires and
+        how specific it is.
+    */
+    struct CompiledStyleSelector
+    {
+        enum Requirement : std::uint8_t
+        {
+            disabled = 1 << 0,
+            focus = 1 << 1,
+            hover = 1 << 2,
+            active = 1 << 3,
+            toggled = 1 << 4,
+        };
+
+        explicit CompiledStyleSelector(const StyleIdentifier& styleID)
+            : requirements{ compileRequirements(styleID) }
+            , specificity{ measureSpecificity(styleID) }
+        {
+        }
+
+        std::uint8_t requirements;
+        unsigned long specificity;
+
+    private:
+        [[nodiscard]] static std::uint8_t compileRequirements(const StyleIdentifier& styleID)
+        {
+            std::uint8_t result = 0;
+
+            if (!styleID.enabled)
+                result |= disabled;
+            if (styleID.keyboard == ComponentInteractionState::Keyboard::focus)
+                result |= focus;
+            if (styleID.mouse != ComponentInteractionState::Mouse::dissociate)
+                result |= hover;
+            if (styleID.mouse == ComponentInteractionState::Mouse::active)
+                result |= active;
+            if (styleID.toggled)
+                result |= toggled;
+
+            return result;
+        }
+
+        // Among the selectors that match a component, this orders them the
+        // same way as comparing each one against the component's state would,
+        // so it only needs measuring once. A component's own styles always
+        // take precedence over those declared by its ancestors.
+        [[nodiscard]] static unsigned long measureSpecificity(const StyleIdentifier& styleID)
+        {
+            std::size_t bit = 0;
+
+            return std::bitset<10>{}
+                .set(bit++, styleID.toggled)
+                .set(bit++, styleID.mouse == ComponentInteractionState::Mouse::hover)
+                .set(bit++, styleID.mouse == ComponentInteractionState::Mouse::active)
+                .set(bit++, styleID.mouse == ComponentInteractionState::Mouse::active)
+                .set(bit++, styleID.keyboard == ComponentInteractionState::Keyboard::focus)
+                .set(bit++, !styleID.enabled)
+                .set(bit++, styleID.type.isNotEmpty())
+                .set(bit++, styleID.className.isNotEmpty())
+                .set(bit++, styleID.id.isNotEmpty())
+                .set(bit++, !styleID.fromAncestor)
+                .to_ulong();
+        }
+    };
+
+    /** Compiled styles, ordered from most to least specific. */
+    template <typename PropertyType>
+    using CompiledStyles = std::vector<std::pair<CompiledStyleSelector, const PropertyType*>>;
+
     struct StyleSelectors
     {
     public:
         explicit StyleSelectors(const juce::ValueTree& sourceState)
             : state{ sourceState }
-            , id{ state, "id" }
-            , classes{ state, "class" }
-            , enabled{ state, "enabled" }
-            , mouse{ state, "mouse" }
-            , keyboard{ state, "keyboard" }
-            , toggled{ state, "toggled" }
+            , id{ state, ids::id }
+            , classes{ state, ids::className }
+            , enabled{ state, ids::enabled }
+            , mouse{ state, ids::mouse }
+            , keyboard{ state, ids::keyboard }
+            , toggled{ state, ids::toggled }
         {
             const auto informListeners = [this]() {
                 if (onChange != nullptr)
                     onChange();
             };
             id.onValueChange = informListeners;
-            enabled.onValueChange = informListeners;
-            mouse.onValueChange = informListeners;
-            keyboard.onValueChange = informListeners;
             classes.onValueChange = informListeners;
-            toggled.onValueChange = informListeners;
-        }
 
-        template <typename PropertyType>
-        [[nodiscard]] const PropertyType* findStyle(const std::unordered_map<StyleIdentifier, PropertyType>& styles) const
-        {
-            if (std::empty(styles))
-                return nullptr;
-
-            auto entries = collectIterators(styles);
-
-            entries.erase(std::remove_if(std::begin(entries),
-                                         std::end(entries),
-                                         [this](auto&& entry) {
-                                             return entry->first.id.isNotEmpty() && entry->first.id != id.toString();
-                                         }),
-                          std::end(entries));
-            entries.erase(std::remove_if(std::begin(entries),
-                                         std::end(entries),
-                                         [this](auto&& entry) {
-                                             return entry->first.className.isNotEmpty() && !classes.get().contains(entry->first.className);
-                                         }),
-                          std::end(entries));
-            entries.erase(std::remove_if(std::begin(entries),
-                                         std::end(entries),
-                                         [this](auto&& entry) {
-                                             return entry->first.type.isNotEmpty() && entry->first.type != state.getType().toString();
-                                         }),
-                          std::end(entries));
-            entries.erase(std::remove_if(std::begin(entries),
-                                         std::end(entries),
-                                         [this](auto&& entry) {
-                                             return !entry->first.enabled && enabled.getOr(true);
-                                         }),
-                          std::end(entries));
-            entries.erase(std::remove_if(std::begin(entries),
-                                         std::end(entries),
-                                         [this](auto&& entry) {
-                                             return entry->first.keyboard != ComponentInteractionState::Keyboard::dissociate
-                                                 && entry->first.keyboard != keyboard.get();
-                                         }),
-                          std::end(entries));
-            entries.erase(std::remove_if(std::begin(entries),
-                                         std::end(entries),
-                                         [this](auto&& entry) {
-                                             if (mouse.get() == ComponentInteractionState::Mouse::active)
-                                             {
-                                                 [[maybe_unused]] auto x = 12;
-                                             }
-
-                                             switch (entry->first.mouse)
-                                             {
-                                             case ComponentInteractionState::Mouse::dissociate:
-                                                 return false;
-                                             case ComponentInteractionState::Mouse::hover:
-                                                 return mouse.get() == ComponentInteractionState::Mouse::dissociate;
-                                             case ComponentInteractionState::Mouse::active:
-                                                 return mouse.get() != ComponentInteractionState::Mouse::active;
-                                             }
-
-                                             jassertfalse;
-                                             return false;
-                                         }),
-                          std::end(entries));
-            entries.erase(std::remove_if(std::begin(entries),
-                                         std::end(entries),
-                                         [this](auto&& entry) {
-                                             return entry->first.toggled && !toggled.get();
-                                         }),
-                          std::end(entries));
-
-            if (std::size(entries) == 0)
-                return nullptr;
-
-            std::sort(std::begin(entries),
-                      std::end(entries),
-                      [this](auto&& first, auto&& second) {
-                          return measureApplicability(first->first) < measureApplicability(second->first);
-                      });
-            return &entries.back()->second;
+            const auto informStateListeners = [this]() {
+                if (onInteractionStateChange != nullptr)
+                    onInteractionStateChange();
+            };
+            enabled.onValueChange = informStateListeners;
+            mouse.onValueChange = informStateListeners;
+            keyboard.onValueChange = informStateListeners;
+            toggled.onValueChange = informStateListeners;
         }
 
         const juce::ValueTree state;
@@ -116,38 +111,43 @@ namespace jive
         const Property<ComponentInteractionState::Mouse> mouse;
         const Property<ComponentInteractionState::Keyboard> keyboard;
         const Property<bool> toggled;
+
+        /** Called when the component's id or classes change. */
         std::function<void()> onChange = nullptr;
 
-    private:
-        template <typename Container>
-        [[nodiscard]] static auto collectIterators(const Container& container)
+        /** Called when the component is enabled or disabled, or its mouse,
+            keyboard or toggle state changes.
+        */
+        std::function<void()> onInteractionStateChange = nullptr;
+
+        /** The number of distinct values getCurrentState() can return. */
+        static constexpr std::size_t numStates = 1 << 5;
+
+        /** Returns the component's current interaction state, as a
+            combination of CompiledStyleSelector::Requirement flags.
+        */
+        [[nodiscard]] std::uint8_t getCurrentState() const
         {
-            std::vector<decltype(&(*std::begin(container)))> result;
-            result.reserve(std::size(container));
+            std::uint8_t result = 0;
 
-            auto current = std::begin(container);
+            if (!enabled.getOr(true))
+                result |= CompiledStyleSelector::disabled;
+            if (keyboard.get() == ComponentInteractionState::Keyboard::focus)
+                result |= CompiledStyleSelector::focus;
 
-            for (std::size_t i = 0; i < std::size(container); i++)
-                result.push_back(&(*current++));
+            if (const auto currentMouse = mouse.get();
+                currentMouse != ComponentInteractionState::Mouse::dissociate)
+            {
+                result |= CompiledStyleSelector::hover;
 
-            return result;
-        }
+                if (currentMouse == ComponentInteractionState::Mouse::active)
+                    result |= CompiledStyleSelector::active;
+            }
 
-        [[nodiscard]] unsigned long measureApplicability(const StyleIdentifier& styleID) const
-        {
-            std::size_t bit = 0;
+            if (toggled.get())
+                result |= CompiledStyleSelector::toggled;
 
-            return std::bitset<9>{}
-                .set(bit++, styleID.toggled == toggled.get())
-                .set(bit++, styleID.mouse == ComponentInteractionState::Mouse::hover)
-                .set(bit++, styleID.mouse == ComponentInteractionState::Mouse::active)
-                .set(bit++, styleID.mouse == mouse.get())
-                .set(bit++, styleID.keyboard == keyboard.get())
-                .set(bit++, !styleID.enabled && !enabled.getOr(true))
-                .set(bit++, styleID.type == state.getType().toString())
-                .set(bit++, classes.get().contains(styleID.className))
-                .set(bit++, styleID.id == id.toString())
-                .to_ulong();
+            return result;
         }
     };
 } // namespace jive
@@ -3,45 +3,42 @@
 namespace jive
 {
     StyleSheet::ReferenceCountedPointer StyleSheet::create(juce::Component& sourceComponent,
-                                                           juce::ValueTree sourceState)
+                                                           juce::ValueTree sourceState,
+                                                           StyleSheet* parentStyleSheet)
     {
-        return new StyleSheet{ sourceComponent, sourceState };
+        return new StyleSheet{ sourceComponent, sourceState, parentStyleSheet };
+    }
+
+    StyleSheet* StyleSheet::findFor(const juce::Component& component)
+    {
+        return dynamic_cast<StyleSheet*>(component.getProperties()[ids::styleSheet].getObject());
     }
 
     StyleSheet::StyleSheet(juce::Component& sourceComponent,
-                           juce::ValueTree sourceState)
+                           juce::ValueTree sourceState,
+                           StyleSheet* parentStyleSheet)
         : component{ &sourceComponent }
         , state{ sourceState }
-        , style{ state, "style" }
-        , selectors{ state }
+        , style{ state, ids::style }
 #if !JIVE_UNIT_TESTS
         , interactionState{ *component, state }
 #endif
-        , borderWidth{ state, "border-width" }
     {
         jassert(component != nullptr);
-        jassert(!component->getProperties().contains("style-sheet"));
+        jassert(!component->getProperties().contains(ids::styleSheet));
 
-        component->getProperties().set("style-sheet", this);
-        component->addAndMakeVisible(backgroundCanvas, 0);
-        backgroundCanvas.setBounds(component->getLocalBounds());
-        backgroundCanvas.setBorderWidth(borderWidth);
+        component->getProperties().set(ids::styleSheet, this);
+
+        if (parentStyleSheet != nullptr)
+            setClosestAncestor(parentStyleSheet);
+        else
+            updateClosestAncestor();
 
-        updateClosestAncestor();
         updateStyles();
 
         style.onValueChange = [this] {
             updateStyles();
         };
-        selectors.onChange = [this] {
-            applyStyles();
-        };
-
-        const auto updateBorderWidth = [this] {
-            backgroundCanvas.setBorderWidth(borderWidth.calculateCurrent());
-        };
-        borderWidth.onValueChange = updateBorderWidth;
-        borderWidth.onTransitionProgressed = updateBorderWidth;
 
         component->addComponentListener(this);
     }
@@ -51,41 +48,28 @@ namespace jive
         if (component != nullptr)
         {
             component->removeComponentListener(this);
-            component->getProperties().remove("style-sheet");
+            component->getProperties().remove(ids::styleSheet);
         }
 
         if (closestAncestor != nullptr)
             closestAncestor->dependants.removeAllInstancesOf(this);
+
+        if (rules != nullptr)
+            rules->removeListener(*this);
     }
 
     Fill StyleSheet::getBackground() const
     {
-        if (auto* background = selectors.findStyle(backgroundStyles))
-        {
-            if (calculatedBackground != nullptr)
-            {
-                *calculatedBackground = background->get();
-                return calculatedBackground->calculateCurrent();
-            }
-
-            return background->calculateCurrent();
-        }
+        if (auto* background = getResolvedStyle().background)
+            return styling->backgroundAnimation.calculateCurrent(background->get());
 
         return {};
     }
 
     Fill StyleSheet::getForeground() const
     {
-        if (auto* foreground = selectors.findStyle(foregroundStyles))
-        {
-            if (calculatedForeground != nullptr)
-            {
-                *calculatedForeground = foreground->get();
-                return calculatedForeground->calculateCurrent();
-            }
-
-            return foreground->calculateCurrent();
-        }
+        if (auto* foreground = getResolvedStyle().foreground)
+            return styling->foregroundAnimation.calculateCurrent(foreground->get());
 
         if (closestAncestor != nullptr)
             return closestAncestor->getForeground();
@@ -95,63 +79,59 @@ namespace jive
 
     Fill StyleSheet::getBorderFill() const
     {
-        if (auto* borderFill = selectors.findStyle(borderFillStyles))
-        {
-            if (calculatedBorderFill != nullptr)
-            {
-                *calculatedBorderFill = borderFill->get();
-                return calculatedBorderFill->calculateCurrent();
-            }
-
-            return borderFill->calculateCurrent();
-        }
+        if (auto* borderFill = getResolvedStyle().borderFill)
+            return styling->borderFillAnimation.calculateCurrent(borderFill->get());
 
         return {};
     }
 
     BorderRadii<float> StyleSheet::getBorderRadii() const
     {
-        if (auto* borderRadii = selectors.findStyle(borderRadiiStyles))
-        {
-            if (calculatedBorderRadii != nullptr)
-            {
-                *calculatedBorderRadii = borderRadii->get();
-                return calculatedBorderRadii->calculateCurrent();
-            }
-
-            return borderRadii->calculateCurrent();
-        }
+        if (auto* borderRadii = getResolvedStyle().borderRadii)
+            return styling->borderRadiiAnimation.calculateCurrent(borderRadii->get());
 
         return {};
     }
 
     juce::Font StyleSheet::getFont() const
     {
-        juce::Font font{
-#if JUCE_MAJOR_VERSION >= 8
-            juce::FontOptions{},
-#endif
-        };
+        // A transitioning font changes from one frame to the next, so is
+        // only worth keeping once it's settled.
+        if (isFontTransitioning())
+            return createFont(getFontAttributes());
 
-        font.setTypefaceName(getFontFamily());
+        const auto currentState = getCurrentState();
 
-        if (juce::Font::getDefaultTypefaceForFont(font) == nullptr)
-            return font;
+        if (std::size(resolvedFonts) <= currentState)
+            resolvedFonts.resize(currentState + 1u);
 
-        font.setItalic(getFontStyle() == "italic");
-        font.setBold(getFontWeight() == "bold");
-        font = font.withPointHeight(getFontSize());
-        font.setExtraKerningFactor(getLetterSpacing() / font.getHeight());
-        font.setUnderline(getTextDecoration() == "underlined");
-        font.setHorizontalScale(getFontStretch());
+        auto& resolvedFont = resolvedFonts[currentState];
 
-        return font;
+        if (!resolvedFont.has_value())
+            resolvedFont = getCachedFont(getFontAttributes());
+
+        return *resolvedFont;
+    }
+
+    FontAttributes StyleSheet::getFontAttributes() const
+    {
+        FontAttributes attributes;
+        attributes.family = getFontFamily();
+        attributes.size = getFontSize();
+        attributes.style = getFontStyle();
+        attributes.weight = getFontWeight();
+        attributes.letterSpacing = getLetterSpacing();
+        attributes.stretch = getFontStretch();
+        attributes.decoration = getTextDecoration();
+
+        return attributes;
     }
 
     void StyleSheet::componentParentHierarchyChanged(juce::Component& comp)
     {
         jassertquiet(&comp == component.getComponent());
         updateClosestAncestor();
+        updateRules();
         applyStyles();
     }
 
@@ -159,15 +139,32 @@ namespace jive
     {
         jassertquiet(&comp == component.getComponent());
 
-        if (!resized)
+        if (!resized || styling == nullptr)
             return;
 
-        backgroundCanvas.setBounds(component->getLocalBounds());
+        styling->backgroundCanvas.setBounds(component->getLocalBounds());
+    }
+
+    void StyleSheet::styleValueChanged()
+    {
+        invalidateResolvedFonts();
+        applyStyles();
+    }
+
+    void StyleSheet::styleTransitionProgressed()
+    {
+        applyStyles();
+    }
+
+    void StyleSheet::styleRulesChanged()
+    {
+        updateRules();
+        applyStyles();
     }
 
     juce::String StyleSheet::getFontFamily() const
     {
-        if (auto* family = selectors.findStyle(fontFamilyStyles))
+        if (auto* family = getResolvedStyle().fontFamily)
             return family->toString();
 
         if (closestAncestor != nullptr)
@@ -182,16 +179,8 @@ namespace jive
 
     float StyleSheet::getFontSize() const
     {
-        if (auto* size = selectors.findStyle(fontSizeStyles))
-        {
-            if (calculatedFontSize != nullptr)
-            {
-                *calculatedFontSize = size->get();
-                return calculatedFontSize->calculateCurrent();
-            }
-
-            return size->calculateCurrent();
-        }
+        if (auto* size = getResolvedStyle().fontSize)
+            return styling->fontSizeAnimation.calculateCurrent(size->get());
 
         if (closestAncestor != nullptr)
             return closestAncestor->getFontSize();
@@ -201,16 +190,8 @@ namespace jive
 
     float StyleSheet::getFontStretch() const
     {
-        if (auto* stretch = selectors.findStyle(fontStretchStyles))
-        {
-            if (calculatedFontStretch != nullptr)
-            {
-                *calculatedFontStretch = stretch->get();
-                return calculatedFontStretch->calculateCurrent();
-            }
-
-            return stretch->calculateCurrent();
-        }
+        if (auto* stretch = getResolvedStyle().fontStretch)
+            return styling->fontStretchAnimation.calculateCurrent(stretch->get());
 
         if (closestAncestor != nullptr)
             return closestAncestor->getFontStretch();
@@ -220,7 +201,7 @@ namespace jive
 
     juce::String StyleSheet::getFontStyle() const
     {
-        if (auto* fontStyle = selectors.findStyle(fontStyleStyles))
+        if (auto* fontStyle = getResolvedStyle().fontStyle)
             return fontStyle->toString();
 
         if (closestAncestor != nullptr)
@@ -231,7 +212,7 @@ namespace jive
 
     juce::String StyleSheet::getFontWeight() const
     {
-        if (auto* weight = selectors.findStyle(fontWeightStyles))
+        if (auto* weight = getResolvedStyle().fontWeight)
             return weight->toString();
 
         if (closestAncestor != nullptr)
@@ -242,16 +223,8 @@ namespace jive
 
     float StyleSheet::getLetterSpacing() const
     {
-        if (auto* spacing = selectors.findStyle(letterSpacingStyles))
-        {
-            if (calculatedLetterSpacing != nullptr)
-            {
-                *calculatedLetterSpacing = spacing->get();
-                return calculatedLetterSpacing->calculateCurrent();
-            }
-
-            return spacing->calculateCurrent();
-        }
+        if (auto* spacing = getResolvedStyle().letterSpacing)
+            return styling->letterSpacingAnimation.calculateCurrent(spacing->get());
 
         if (closestAncestor != nullptr)
             return closestAncestor->getLetterSpacing();
@@ -261,7 +234,7 @@ namespace jive
 
     juce::String StyleSheet::getTextDecoration() const
     {
-        if (auto* decoration = selectors.findStyle(textDecorationStyles))
+        if (auto* decoration = getResolvedStyle().textDecoration)
             return decoration->toString();
 
         if (closestAncestor != nullptr)
@@ -270,198 +243,379 @@ namespace jive
         return "normal";
     }
 
+    std::uint8_t StyleSheet::getCurrentState() const
+    {
+        if (styling == nullptr)
+            return 0;
+
+        return styling->selectors.getCurrentState();
+    }
+
+    const StyleRules::Resolution& StyleSheet::getResolvedStyle() const
+    {
+        if (rules == nullptr)
+        {
+            static const StyleRules::Resolution noStyles;
+            return noStyles;
+        }
+
+        return rules->resolve(getCurrentState());
+    }
+
+    bool StyleSheet::isFontTransitioning() const
+    {
+        if (styling != nullptr
+            && (styling->fontSizeAnimation.isInProgress()
+                || styling->fontStretchAnimation.isInProgress()
+                || styling->letterSpacingAnimation.isInProgress()))
+        {
+            return true;
+        }
+
+        if (closestAncestor != nullptr)
+            return closestAncestor->isFontTransitioning();
+
+        return false;
+    }
+
+    void StyleSheet::invalidateResolvedFonts()
+    {
+        resolvedFonts.clear();
+    }
+
+    const Transition* StyleSheet::findTransition(const juce::Identifier& styleProperty) const
+    {
+        if (styling == nullptr || styling->transitions == nullptr)
+            return nullptr;
+
+        return (*styling->transitions)[styleProperty.toString()];
+    }
+
+    void StyleSheet::updateTransitions()
+    {
+        const auto styleState = style.get();
+        const auto source = styleState != nullptr
+                              ? styleState->getProperty(ids::transition)
+                              : juce::var{};
+
+        if (source.equalsWithSameType(styling->transitionsSource))
+            return;
+
+        // The parsed transitions stay with this StyleSheet; the style object
+        // belongs to the user and is never written to.
+        styling->transitions = fromVar<Transitions::ReferenceCountedPointer>(source);
+        styling->transitionsSource = source;
+    }
+
+    void StyleSheet::updateAnimationTimer()
+    {
+        if (!styling->animationsInProgress)
+        {
+            if (styling->animationTimer != nullptr)
+                styling->animationTimer->stop();
+
+            return;
+        }
+
+        if (styling->animationTimer == nullptr)
+        {
+            styling->animationTimer = std::make_unique<Timer>(
+                [this](juce::Time) {
+                    applyStyles();
+                },
+                juce::RelativeTime::seconds(1.0 / 60.0));
+        }
+        else
+        {
+            styling->animationTimer->start();
+        }
+    }
+
+    void StyleSheet::updateAnimations()
+    {
+        // The animations may still refer to the previous transitions until
+        // they've been retargeted.
+        const auto previousTransitions = styling->transitions;
+        updateTransitions();
+
+        const auto& resolvedStyle = getResolvedStyle();
+        styling->animationsInProgress = false;
+
+        const auto retarget = [this](auto& animation, const auto* resolved, const juce::Identifier& styleProperty) {
+            if (resolved == nullptr)
+                animation = {};
+            else
+                animation.retarget(resolved->get(), findTransition(styleProperty));
+
+            styling->animationsInProgress = styling->animationsInProgress || animation.isInProgress();
+        };
+        retarget(styling->backgroundAnimation, resolvedStyle.background, ids::background);
+        retarget(styling->foregroundAnimation, resolvedStyle.foreground, ids::foreground);
+        retarget(styling->borderFillAnimation, resolvedStyle.borderFill, ids::border);
+        retarget(styling->borderRadiiAnimation, resolvedStyle.borderRadii, ids::borderRadius);
+        retarget(styling->fontSizeAnimation, resolvedStyle.fontSize, ids::fontSize);
+        retarget(styling->fontStretchAnimation, resolvedStyle.fontStretch, ids::fontStretch);
+        retarget(styling->letterSpacingAnimation, resolvedStyle.letterSpacing, ids::letterSpacing);
+
+        updateAnimationTimer();
+    }
+
     [[nodiscard]] static StyleSheet* findClosestAncestorStyleSheet(const juce::Component& rootComponent)
     {
         for (auto* parent = rootComponent.getParentComponent();
              parent != nullptr;
              parent = parent->getParentComponent())
         {
-            if (auto& properties = parent->getProperties();
-                properties.contains("style-sheet"))
-            {
-                return dynamic_cast<StyleSheet*>(properties["style-sheet"].getObject());
-            }
+            if (auto* styleSheet = StyleSheet::findFor(*parent))
+                return styleSheet;
         }
 
         return nullptr;
     }
 
-    void StyleSheet::updateClosestAncestor()
+    void StyleSheet::setClosestAncestor(StyleSheet* newClosestAncestor)
     {
+        if (newClosestAncestor == closestAncestor.get())
+            return;
+
         if (closestAncestor != nullptr)
             closestAncestor->dependants.removeAllInstancesOf(this);
 
+        closestAncestor = newClosestAncestor;
+
+        if (closestAncestor != nullptr)
+            closestAncestor->dependants.add(this);
+    }
+
+    void StyleSheet::updateClosestAncestor()
+    {
         if (component == nullptr)
         {
-            closestAncestor = nullptr;
+            setClosestAncestor(nullptr);
             return;
         }
 
-        closestAncestor = findClosestAncestorStyleSheet(*component);
+        // Components are almost always added straight to the component of the
+        // StyleSheet they were created with, so there's no need to search.
+        if (closestAncestor != nullptr
+            && closestAncestor->component != nullptr
+            && closestAncestor->component == component->getParentComponent())
+        {
+            return;
+        }
 
-        if (closestAncestor != nullptr)
-            closestAncestor->dependants.add(this);
+        setClosestAncestor(findClosestAncestorStyleSheet(*component));
     }
 
-    void StyleSheet::updateStyles(jive::Object& source, StyleIdentifier styleID)
+    void StyleSheet::createStyling()
     {
-        const auto appendStyle = [&](const auto& styleProperty, auto& styles) {
-            using PropertyType = std::remove_reference_t<decltype(styles[styleID])>;
+        jassert(component != nullptr);
+        styling = std::make_unique<Styling>(state);
 
-            if (source.hasProperty(styleProperty) && styles.find(styleID) == std::end(styles))
-            {
-                styles.insert(std::make_pair(styleID, PropertyType{ &source, styleProperty }));
-                styles.at(styleID).onValueChange = [this] {
-                    applyStyles();
-                };
-                styles.at(styleID).onTransitionProgressed = [this] {
-                    applyStyles();
-                };
-            }
+        auto& canvas = styling->backgroundCanvas;
+        component->addAndMakeVisible(canvas, 0);
+        canvas.setBounds(component->getLocalBounds());
+        canvas.setBorderWidth(styling->borderWidth);
+
+        styling->selectors.onChange = [this] {
+            updateRules();
+            applyStyles();
+        };
+        styling->selectors.onInteractionStateChange = [this] {
+            applyStyles();
         };
-        appendStyle("background", backgroundStyles);
-        appendStyle("foreground", foregroundStyles);
-        appendStyle("border", borderFillStyles);
-        appendStyle("border-radius", borderRadiiStyles);
-        appendStyle("font-family", fontFamilyStyles);
-        appendStyle("font-size", fontSizeStyles);
-        appendStyle("font-stretch", fontStretchStyles);
-        appendStyle("font-style", fontStyleStyles);
-        appendStyle("font-weight", fontWeightStyles);
-        appendStyle("letter-spacing", letterSpacingStyles);
-        appendStyle("text-decoration", textDecorationStyles);
-
-        const auto appendNestedStyles = [&](const auto& property, auto&& updateNewID) {
-            if (auto* child = dynamic_cast<jive::Object*>(source[property].getObject()))
-            {
-                auto newID = styleID;
-                updateNewID(newID);
 
-                updateStyles(*child, newID);
-            }
+        const auto updateBorderWidth = [this] {
+            styling->backgroundCanvas.setBorderWidth(styling->borderWidth.calculateCurrent());
         };
+        styling->borderWidth.onValueChange = updateBorderWidth;
+        styling->borderWidth.onTransitionProgressed = updateBorderWidth;
+    }
+
+    void StyleSheet::updateRules()
+    {
+        juce::Array<StyleIndex::ReferenceCountedPointer> ancestorStyles;
 
-        if (selectors.id.exists())
+        for (auto* ancestor = closestAncestor.get();
+             ancestor != nullptr;
+             ancestor = ancestor->closestAncestor.get())
         {
-            appendNestedStyles(selectors.id.toString(),
-                               [&](auto& newID) {
-                                   newID.id = selectors.id.get();
-                               });
+            if (ancestor->styleIndex != nullptr && !ancestor->styleIndex->isEmpty())
+                ancestorStyles.add(ancestor->styleIndex);
         }
 
-        for (const auto& className : selectors.classes.get())
+        StyleRules::ReferenceCountedPointer newRules;
+
+        if (auto styleState = style.get();
+            component != nullptr && (styleState != nullptr || !ancestorStyles.isEmpty()))
         {
-            appendNestedStyles(className,
-                               [&](auto& newID) {
-                                   newID.className = className;
-                               });
+            if (styling == nullptr)
+                createStyling();
+
+            newRules = StyleRules::getFor({
+                styleState,
+                state.getType().toString(),
+                styling->selectors.id.get(),
+                styling->selectors.classes.get(),
+                ancestorStyles,
+            });
         }
 
-        appendNestedStyles(selectors.state.getType().toString(),
-                           [&](auto& newID) {
-                               newID.type = selectors.state.getType().toString();
-                           });
-        appendNestedStyles("disabled",
-                           [&](auto& newID) {
-                               newID.enabled = false;
-                           });
-        appendNestedStyles("focus",
-                           [&](auto& newID) {
-                               newID.keyboard = ComponentInteractionState::Keyboard::focus;
-                           });
-        appendNestedStyles("active",
-                           [&](auto& newID) {
-                               newID.mouse = ComponentInteractionState::Mouse::active;
-                           });
-        appendNestedStyles("hover",
-                           [&](auto& newID) {
-                               newID.mouse = ComponentInteractionState::Mouse::hover;
-                           });
-        appendNestedStyles("checked",
-                           [&](auto& newID) {
-                               newID.toggled = true;
-                           });
+        if (newRules != rules)
+        {
+            if (rules != nullptr)
+                rules->removeListener(*this);
+
+            rules = newRules;
+
+            if (rules != nullptr)
+                rules->addListener(*this);
+        }
+
+        invalidateResolvedFonts();
     }
 
     void StyleSheet::updateStyles()
     {
-        backgroundStyles.clear();
-        foregroundStyles.clear();
-        borderFillStyles.clear();
-        borderRadiiStyles.clear();
-        fontFamilyStyles.clear();
-        fontSizeStyles.clear();
-        fontStretchStyles.clear();
-        fontStyleStyles.clear();
-        fontWeightStyles.clear();
-        letterSpacingStyles.clear();
-        textDecorationStyles.clear();
-
         if (auto styleState = style.get(); styleState != nullptr)
-        {
-            updateStyles(*styleState, StyleIdentifier{});
+            styleIndex = StyleIndex::getFor(styleState);
+        else
+            styleIndex = nullptr;
 
-            const auto onTransitionProgressed = [this] {
-                applyStyles();
-            };
+        updateRules();
+        applyStyles();
 
-            calculatedBackground = std::make_unique<Property<Fill>>(styleState, "calculated-background");
-            calculatedBackground->setTransitionSourceProperty("background");
-            calculatedBackground->onTransitionProgressed = onTransitionProgressed;
+        for (auto* dependant : dependants)
+            dependant->ancestorStylesChanged();
+    }
 
-            calculatedForeground = std::make_unique<Property<Fill>>(styleState, "calculated-foreground");
-            calculatedForeground->setTransitionSourceProperty("foreground");
-            calculatedForeground->onTransitionProgressed = onTransitionProgressed;
+    void StyleSheet::ancestorStylesChanged()
+    {
+        updateRules();
+        applyStyles();
 
-            calculatedBorderFill = std::make_unique<Property<Fill>>(styleState, "calculated-border");
-            calculatedBorderFill->setTransitionSourceProperty("border");
-            calculatedBorderFill->onTransitionProgressed = onTransitionProgressed;
+        for (auto* dependant : dependants)
+            dependant->ancestorStylesChanged();
+    }
 
-            calculatedBorderRadii = std::make_unique<Property<BorderRadii<float>>>(styleState, "calculated-border-radius");
-            calculatedBorderRadii->setTransitionSourceProperty("border-radius");
-            calculatedBorderRadii->onTransitionProgressed = onTransitionProgressed;
+    void StyleSheet::applyStyles()
+    {
+        if (styling != nullptr)
+        {
+            updateAnimations();
 
-            calculatedFontSize = std::make_unique<Property<float>>(styleState, "calculated-font-size");
-            calculatedFontSize->setTransitionSourceProperty("font-size");
-            calculatedFontSize->onTransitionProgressed = onTransitionProgressed;
+            styling->backgroundCanvas.setFill(getBackground());
+            styling->backgroundCanvas.setBorderFill(getBorderFill());
+            styling->backgroundCanvas.setBorderRadii(getBorderRadii());
+        }
 
-            calculatedFontStretch = std::make_unique<Property<float>>(styleState, "calculated-font-stretch");
-            calculatedFontStretch->setTransitionSourceProperty("font-stretch");
-            calculatedFontStretch->onTransitionProgressed = onTransitionProgressed;
+        applyInheritableStyles();
+    }
 
-            calculatedLetterSpacing = std::make_unique<Property<float>>(styleState, "calculated-letter-spacing");
-            calculatedLetterSpacing->setTransitionSourceProperty("letter-spacing");
-            calculatedLetterSpacing->onTransitionProgressed = onTransitionProgressed;
-        }
+    StyleSheet::InheritableStyles StyleSheet::getInheritableStyles() const
+    {
+        return {
+            getForeground(),
+            getFontFamily(),
+            getFontSize(),
+            getFontStretch(),
+            getFontStyle(),
+            getFontWeight(),
+            getLetterSpacing(),
+            getTextDecoration(),
+        };
+    }
 
-        applyStyles();
+    [[nodiscard]] static std::uint8_t findChangedChannels(const StyleSheet::InheritableStyles& previous,
+                                                          const StyleSheet::InheritableStyles& current)
+    {
+        std::uint8_t result = 0;
+
+        if (previous.foreground != current.foreground)
+            result |= StyleSheet::InheritableStyles::foregroundChannel;
+        if (previous.fontFamily != current.fontFamily)
+            result |= StyleSheet::InheritableStyles::fontFamilyChannel;
+        if (previous.fontSize != current.fontSize)
+            result |= StyleSheet::InheritableStyles::fontSizeChannel;
+        if (previous.fontStretch != current.fontStretch)
+            result |= StyleSheet::InheritableStyles::fontStretchChannel;
+        if (previous.fontStyle != current.fontStyle)
+            result |= StyleSheet::InheritableStyles::fontStyleChannel;
+        if (previous.fontWeight != current.fontWeight)
+            result |= StyleSheet::InheritableStyles::fontWeightChannel;
+        if (previous.letterSpacing != current.letterSpacing)
+            result |= StyleSheet::InheritableStyles::letterSpacingChannel;
+        if (previous.textDecoration != current.textDecoration)
+            result |= StyleSheet::InheritableStyles::textDecorationChannel;
+
+        return result;
     }
 
-    void StyleSheet::applyStyles()
+    std::uint8_t StyleSheet::getInheritedChannels() const
     {
-        backgroundCanvas.setFill(getBackground());
-        backgroundCanvas.setBorderFill(getBorderFill());
-        backgroundCanvas.setBorderRadii(getBorderRadii());
+        const auto& resolvedStyle = getResolvedStyle();
+        std::uint8_t result = 0;
+
+        if (resolvedStyle.foreground == nullptr)
+            result |= InheritableStyles::foregroundChannel;
+        if (resolvedStyle.fontFamily == nullptr)
+            result |= InheritableStyles::fontFamilyChannel;
+        if (resolvedStyle.fontSize == nullptr)
+            result |= InheritableStyles::fontSizeChannel;
+        if (resolvedStyle.fontStretch == nullptr)
+            result |= InheritableStyles::fontStretchChannel;
+        if (resolvedStyle.fontStyle == nullptr)
+            result |= InheritableStyles::fontStyleChannel;
+        if (resolvedStyle.fontWeight == nullptr)
+            result |= InheritableStyles::fontWeightChannel;
+        if (resolvedStyle.letterSpacing == nullptr)
+            result |= InheritableStyles::letterSpacingChannel;
+        if (resolvedStyle.textDecoration == nullptr)
+            result |= InheritableStyles::textDecorationChannel;
+
+        return result;
+    }
 
-        const auto foreground = getForeground();
+    void StyleSheet::applyInheritableStyles()
+    {
+        const auto inheritableStyles = getInheritableStyles();
 
         if (auto* text = dynamic_cast<TextComponent*>(component.getComponent()))
         {
             // TextComponent uses `juce::AttributedString` which doesn't
             // currently support anything other than solid colours!
-            jassert(foreground.getColour().has_value());
-            text->setTextColour(foreground.getColour().value_or(juce::Colours::hotpink));
+            jassert(inheritableStyles.foreground.getColour().has_value());
+            text->setTextColour(inheritableStyles.foreground.getColour().value_or(juce::Colours::hotpink));
             text->setFont(getFont());
         }
         if (state.getType().toString().compareIgnoreCase("svg") == 0)
         {
-            state.setProperty("fill",
-                              "#" + foreground.getColour()->toDisplayString(false),
+            state.setProperty(ids::fill,
+                              "#" + inheritableStyles.foreground.getColour()->toDisplayString(false),
                               nullptr);
         }
 
+        const auto changedChannels = appliedInheritableStyles.has_value()
+                                       ? findChangedChannels(*appliedInheritableStyles, inheritableStyles)
+                                       : static_cast<std::uint8_t>(InheritableStyles::allChannels);
+        appliedInheritableStyles = inheritableStyles;
+
+        if (changedChannels == 0)
+            return;
+
         for (auto* dependant : dependants)
-            dependant->applyStyles();
+            dependant->inheritedStylesChanged(changedChannels);
+    }
+
+    void StyleSheet::inheritedStylesChanged(std::uint8_t changedChannels)
+    {
+        // Fonts are cached for every interaction state, including those in
+        // which the component doesn't currently override the channel.
+        if ((changedChannels & ~InheritableStyles::foregroundChannel) != 0)
+            invalidateResolvedFonts();
+
+        if ((changedChannels & getInheritedChannels()) != 0)
+            applyInheritableStyles();
     }
 } // namespace jive
 
@@ -480,7 +634,12 @@ public:
     {
         testFindingStylesInLocalStyleSheet();
         testFindingStylesInParentStyleSheets();
+        testSelectorSpecificity();
+        testResolvedFonts();
+        testInheritedStylePropagation();
+        testAncestorStyles();
         testChangingStylesDuringRuntime();
+        testTransitions();
     }
 
 private:
@@ -504,7 +663,14 @@ private:
             const auto styleSheet = jive::StyleSheet::create(component, state);
             expectEquals(styleSheet->getBackground(),
                          jive::Fill{});
-            expectEquals(findCanvas(component)->getFill(), jive::Fill{});
+            expect(findCanvas(component) == nullptr);
+
+            state.setProperty("style",
+                              new jive::Object{ { "background", "#ABCDEF" } },
+                              nullptr);
+            expect(findCanvas(component) != nullptr);
+            expectEquals(findCanvas(component)->getFill(),
+                         jive::Fill{ juce::Colour{ 0xFFABCDEF } });
         }
 
         beginTest("finding styles locally / basic");
@@ -649,6 +815,339 @@ private:
                          jive::Fill{ juce::Colour{ 0xFF777444 } });
             expectEquals(component.getTextColour(), juce::Colour{ 0xFF777444 });
         }
+
+        beginTest("finding styles among parents / before being added to the parent");
+        {
+            juce::Component parent;
+            jive::TextComponent component;
+            juce::ValueTree parentState{
+                "Component",
+                {
+                    { "style", new jive::Object{ { "foreground", "#444777" } } },
+                },
+                {
+                    juce::ValueTree{ "Component" },
+                },
+            };
+            const auto parentStyleSheet = jive::StyleSheet::create(parent, parentState);
+            const auto styleSheet = jive::StyleSheet::create(component,
+                                                             parentState.getChild(0),
+                                                             parentStyleSheet.get());
+            expectEquals(component.getTextColour(), juce::Colour{ 0xFF444777 });
+            expect(findCanvas(component) == nullptr);
+
+            parent.addChildComponent(component);
+            expectEquals(styleSheet->getForeground(),
+                         jive::Fill{ juce::Colour{ 0xFF444777 } });
+            expectEquals(component.getTextColour(), juce::Colour{ 0xFF444777 });
+        }
+    }
+
+    void testSelectorSpecificity()
+    {
+        beginTest("selector specificity");
+
+        const jive::Object::ReferenceCountedPointer style = new jive::Object{
+            { "background", "#000000" },
+            { "hover", new jive::Object{ { "background", "#111111" } } },
+            { "active", new jive::Object{ { "background", "#222222" } } },
+            { "focus", new jive::Object{ { "background", "#333333" } } },
+            { "checked", new jive::Object{ { "background", "#444444" } } },
+            { "disabled", new jive::Object{ { "background", "#555555" } } },
+            {
+                ".primary",
+                new jive::Object{
+                    { "hover", new jive::Object{ { "background", "#666666" } } },
+                },
+            },
+            {
+                "#unused",
+                new jive::Object{ { "background", "#777777" } },
+            },
+            {
+                "Button",
+                new jive::Object{ { "background", "#888888" } },
+            },
+        };
+
+        for (const auto isPrimary : { false, true })
+        {
+            juce::Component component;
+            juce::ValueTree state{
+                "Component",
+                {
+                    { "class", isPrimary ? "primary" : "secondary" },
+                    { "style", style.get() },
+                },
+            };
+            const auto styleSheet = jive::StyleSheet::create(component, state);
+
+            for (const auto enabled : { true, false })
+            {
+                for (const auto* mouse : { "dissociate", "hover", "active" })
+                {
+                    for (const auto* keyboard : { "dissociate", "focus" })
+                    {
+                        for (const auto toggled : { false, true })
+                        {
+                            state.setProperty("enabled", enabled, nullptr);
+                            state.setProperty("mouse", mouse, nullptr);
+                            state.setProperty("keyboard", keyboard, nullptr);
+                            state.setProperty("toggled", toggled, nullptr);
+
+                            const auto isHovered = juce::String{ mouse } != "dissociate";
+                            const auto expected = [&]() -> juce::uint32 {
+                                if (isPrimary && isHovered)
+                                    return 0xFF666666;
+                                if (!enabled)
+                                    return 0xFF555555;
+                                if (juce::String{ keyboard } == "focus")
+                                    return 0xFF333333;
+                                if (juce::String{ mouse } == "active")
+                                    return 0xFF222222;
+                                if (isHovered)
+                                    return 0xFF111111;
+                                if (toggled)
+                                    return 0xFF444444;
+
+                                return 0xFF000000;
+                            }();
+                            expectEquals(styleSheet->getBackground(),
+                                         jive::Fill{ juce::Colour{ expected } },
+                                         state.toXmlString());
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void testResolvedFonts()
+    {
+        beginTest("resolved fonts / interaction states");
+        {
+            jive::TextComponent component;
+            juce::ValueTree state{
+                "Component",
+                {
+                    {
+                        "style",
+                        new jive::Object{
+                            { "font-family", "Helvetica" },
+                            { "hover", new jive::Object{ { "font-family", "Arial" } } },
+                        },
+                    },
+                },
+            };
+            jive::Property<juce::String> fontFamily{
+                dynamic_cast<jive::Object*>(state["style"].getObject()),
+                "font-family",
+            };
+            const auto styleSheet = jive::StyleSheet::create(component, state);
+            expectEquals<juce::String>(component.getFont().getTypefaceName(), "Helvetica");
+
+            state.setProperty("mouse", "hover", nullptr);
+            expectEquals<juce::String>(component.getFont().getTypefaceName(), "Arial");
+
+            state.setProperty("mouse", "dissociate", nullptr);
+            expectEquals<juce::String>(component.getFont().getTypefaceName(), "Helvetica");
+
+            fontFamily = "Courier New";
+            expectEquals<juce::String>(component.getFont().getTypefaceName(), "Courier New");
+
+            state.setProperty("mouse", "hover", nullptr);
+            expectEquals<juce::String>(component.getFont().getTypefaceName(), "Arial");
+        }
+
+        beginTest("resolved fonts / inherited from an ancestor");
+        {
+            juce::Component parent;
+            jive::TextComponent component;
+            parent.addChildComponent(component);
+            juce::ValueTree parentState{
+                "Component",
+                {
+                    {
+                        "style",
+                        new jive::Object{
+                            { "font-family", "Times New Roman" },
+                            { "hover", new jive::Object{ { "font-family", "Verdana" } } },
+                        },
+                    },
+                },
+                {
+                    juce::ValueTree{ "Component" },
+                },
+            };
+            const auto parentStyleSheet = jive::StyleSheet::create(parent, parentState);
+            const auto styleSheet = jive::StyleSheet::create(component, parentState.getChild(0));
+            expectEquals<juce::String>(component.getFont().getTypefaceName(), "Times New Roman");
+
+            parentState.setProperty("mouse", "hover", nullptr);
+            expectEquals<juce::String>(component.getFont().getTypefaceName(), "Verdana");
+
+            parentState.setProperty("mouse", "dissociate", nullptr);
+            expectEquals<juce::String>(component.getFont().getTypefaceName(), "Times New Roman");
+        }
+    }
+
+    void testInheritedStylePropagation()
+    {
+        beginTest("inherited style propagation");
+
+        juce::Component parent;
+        jive::TextComponent inheritingChild;
+        jive::TextComponent overridingChild;
+        parent.addChildComponent(inheritingChild);
+        parent.addChildComponent(overridingChild);
+        juce::ValueTree parentState{
+            "Component",
+            {
+                {
+                    "style",
+                    new jive::Object{
+                        { "foreground", "#111111" },
+                        { "font-family", "Times New Roman" },
+                        { "hover", new jive::Object{ { "background", "#222222" } } },
+                        { "active", new jive::Object{ { "foreground", "#333333" } } },
+                    },
+                },
+            },
+            {
+                juce::ValueTree{ "Component" },
+                juce::ValueTree{
+                    "Component",
+                    {
+                        {
+                            "style",
+                            new jive::Object{
+                                { "foreground", "#444444" },
+                                { "hover", new jive::Object{ { "font-family", "Verdana" } } },
+                            },
+                        },
+                    },
+                },
+            },
+        };
+        jive::Property<juce::String> parentFontFamily{
+            dynamic_cast<jive::Object*>(parentState["style"].getObject()),
+            "font-family",
+        };
+        const auto parentStyleSheet = jive::StyleSheet::create(parent, parentState);
+        const auto inheritingStyleSheet = jive::StyleSheet::create(inheritingChild, parentState.getChild(0));
+        const auto overridingStyleSheet = jive::StyleSheet::create(overridingChild, parentState.getChild(1));
+        expectEquals(inheritingChild.getTextColour(), juce::Colour{ 0xFF111111 });
+        expectEquals(overridingChild.getTextColour(), juce::Colour{ 0xFF444444 });
+
+        parentState.setProperty("mouse", "hover", nullptr);
+        expectEquals(findCanvas(parent)->getFill(), jive::Fill{ juce::Colour{ 0xFF222222 } });
+        expectEquals(inheritingChild.getTextColour(), juce::Colour{ 0xFF111111 });
+
+        parentState.setProperty("mouse", "active", nullptr);
+        expectEquals(inheritingChild.getTextColour(), juce::Colour{ 0xFF333333 });
+        expectEquals(overridingChild.getTextColour(), juce::Colour{ 0xFF444444 });
+
+        parentState.getChild(1).setProperty("mouse", "hover", nullptr);
+        expectEquals<juce::String>(overridingChild.getFont().getTypefaceName(), "Verdana");
+
+        parentFontFamily = "Courier New";
+        expectEquals<juce::String>(inheritingChild.getFont().getTypefaceName(), "Courier New");
+        expectEquals<juce::String>(overridingChild.getFont().getTypefaceName(), "Verdana");
+
+        parentState.getChild(1).setProperty("mouse", "dissociate", nullptr);
+        expectEquals<juce::String>(overridingChild.getFont().getTypefaceName(), "Courier New");
+    }
+
+    void testAncestorStyles()
+    {
+        beginTest("ancestor styles");
+
+        juce::Component root;
+        juce::Component group;
+        juce::Component button;
+        juce::Component knob;
+        juce::Component special;
+        root.addChildComponent(group);
+        group.addChildComponent(button);
+        group.addChildComponent(knob);
+        group.addChildComponent(special);
+
+        juce::ValueTree rootState{
+            "Component",
+            {
+                {
+                    "style",
+                    new jive::Object{
+                        { "background", "#000000" },
+                        {
+                            "Button",
+                            new jive::Object{
+                                { "background", "#111111" },
+                                { "hover", new jive::Object{ { "background", "#222222" } } },
+                            },
+                        },
+                        { ".knob", new jive::Object{ { "background", "#333333" } } },
+                        { "#special", new jive::Object{ { "background", "#444444" } } },
+                    },
+                },
+            },
+            {
+                juce::ValueTree{
+                    "Group",
+                    {},
+                    {
+                        juce::ValueTree{ "Button" },
+                        juce::ValueTree{ "Component", { { "class", "knob" } } },
+                        juce::ValueTree{
+                            "Button",
+                            {
+                                { "id", "special" },
+                                { "style", new jive::Object{ { "border", "#555555" } } },
+                            },
+                        },
+                    },
+                },
+            },
+        };
+        auto groupState = rootState.getChild(0);
+        const auto rootStyleSheet = jive::StyleSheet::create(root, rootState);
+        const auto groupStyleSheet = jive::StyleSheet::create(group, groupState);
+        const auto buttonStyleSheet = jive::StyleSheet::create(button, groupState.getChild(0));
+        const auto knobStyleSheet = jive::StyleSheet::create(knob, groupState.getChild(1));
+        const auto specialStyleSheet = jive::StyleSheet::create(special, groupState.getChild(2));
+        expectEquals(groupStyleSheet->getBackground(), jive::Fill{});
+        expectEquals(buttonStyleSheet->getBackground(), jive::Fill{ juce::Colour{ 0xFF111111 } });
+        expectEquals(knobStyleSheet->getBackground(), jive::Fill{ juce::Colour{ 0xFF333333 } });
+        expectEquals(specialStyleSheet->getBackground(), jive::Fill{ juce::Colour{ 0xFF444444 } });
+        expectEquals(specialStyleSheet->getBorderFill(), jive::Fill{ juce::Colour{ 0xFF555555 } });
+
+        groupState.getChild(0).setProperty("mouse", "hover", nullptr);
+        expectEquals(buttonStyleSheet->getBackground(), jive::Fill{ juce::Colour{ 0xFF222222 } });
+        groupState.getChild(0).setProperty("mouse", "dissociate", nullptr);
+
+        groupState.setProperty("style",
+                               new jive::Object{
+                                   { "Button", new jive::Object{ { "background", "#666666" } } },
+                               },
+                               nullptr);
+        expectEquals(buttonStyleSheet->getBackground(), jive::Fill{ juce::Colour{ 0xFF666666 } });
+        expectEquals(findCanvas(button)->getFill(), jive::Fill{ juce::Colour{ 0xFF666666 } });
+        expectEquals(knobStyleSheet->getBackground(), jive::Fill{ juce::Colour{ 0xFF333333 } });
+
+        rootState.setProperty("style",
+                              new jive::Object{
+                                  { ".knob", new jive::Object{ { "background", "#777777" } } },
+                              },
+                              nullptr);
+        expectEquals(knobStyleSheet->getBackground(), jive::Fill{ juce::Colour{ 0xFF777777 } });
+        expectEquals(findCanvas(knob)->getFill(), jive::Fill{ juce::Colour{ 0xFF777777 } });
+        expectEquals(specialStyleSheet->getBackground(), jive::Fill{ juce::Colour{ 0xFF666666 } });
+
+        auto& rootStyle = dynamic_cast<jive::Object&>(*rootState["style"].getObject());
+        rootStyle.setProperty(".knob", new jive::Object{ { "background", "#888888" } });
+        expectEquals(knobStyleSheet->getBackground(), jive::Fill{ juce::Colour{ 0xFF888888 } });
+        expectEquals(findCanvas(knob)->getFill(), jive::Fill{ juce::Colour{ 0xFF888888 } });
+        expectEquals(specialStyleSheet->getBackground(), jive::Fill{ juce::Colour{ 0xFF666666 } });
     }
 
     void testChangingStylesDuringRuntime()
@@ -678,6 +1177,30 @@ private:
             expectEquals<juce::String>(component.getFont().getTypefaceName(), "Comic Sans MS");
         }
 
+        beginTest("changing styles / changing classes");
+        {
+            juce::Component component;
+            juce::ValueTree state{
+                "Component",
+                {
+                    { "class", "first" },
+                    {
+                        "style",
+                        new jive::Object{
+                            { ".first", new jive::Object{ { "background", "#111111" } } },
+                            { ".second", new jive::Object{ { "background", "#222222" } } },
+                        },
+                    },
+                },
+            };
+            const auto styleSheet = jive::StyleSheet::create(component, state);
+            expectEquals(styleSheet->getBackground(), jive::Fill{ juce::Colour{ 0xFF111111 } });
+
+            state.setProperty("class", "second", nullptr);
+            expectEquals(styleSheet->getBackground(), jive::Fill{ juce::Colour{ 0xFF222222 } });
+            expectEquals(findCanvas(component)->getFill(), jive::Fill{ juce::Colour{ 0xFF222222 } });
+        }
+
         beginTest("changing styles / changing properties in selectors");
         {
             juce::Component component;
@@ -796,6 +1319,69 @@ private:
             expectEquals(component.getTextColour(), juce::Colour{ 0xFF775647 });
         }
     }
+
+    void testTransitions()
+    {
+        beginTest("transitions");
+
+        struct Listener : jive::Object::Listener
+        {
+            void propertyChanged(jive::Object&, const juce::Identifier&) final
+            {
+                numChanges++;
+            }
+
+            int numChanges = 0;
+        };
+
+        juce::Component component;
+        juce::ValueTree state{
+            "Component",
+            {
+                {
+                    "style",
+                    new jive::Object{
+                        { "border-radius", 0 },
+                        { "transition", "border-radius 1s" },
+                        {
+                            "hover",
+                            new jive::Object{
+                                { "border-radius", 10 },
+                            },
+                        },
+                    },
+                },
+            },
+        };
+        auto& styleObject = dynamic_cast<jive::Object&>(*state["style"].getObject());
+        Listener listener;
+        styleObject.addListener(listener);
+        const auto styleSheet = jive::StyleSheet::create(component, state);
+        expect(styleSheet->getBorderRadii() == jive::BorderRadii{ 0.0f });
+
+        juce::Component otherComponent;
+        juce::ValueTree otherState{ "Component", { { "style", state["style"] } } };
+        const auto otherStyleSheet = jive::StyleSheet::create(otherComponent, otherState);
+
+        state.setProperty("mouse", "hover", nullptr);
+        expect(styleSheet->getBorderRadii() == jive::BorderRadii{ 0.0f });
+
+        jive::FakeTime::incrementTime(juce::RelativeTime::seconds(0.5));
+        expect(styleSheet->getBorderRadii() == jive::BorderRadii{ 5.0f });
+        expect(findCanvas(component)->getBorderRadii() == jive::BorderRadii{ 5.0f });
+
+        jive::FakeTime::incrementTime(juce::RelativeTime::seconds(0.25));
+        state.setProperty("mouse", "dissociate", nullptr);
+        expect(styleSheet->getBorderRadii() == jive::BorderRadii{ 7.5f });
+
+        jive::FakeTime::incrementTime(juce::RelativeTime::seconds(1.0));
+        expect(styleSheet->getBorderRadii() == jive::BorderRadii{ 0.0f });
+        expect(findCanvas(component)->getBorderRadii() == jive::BorderRadii{ 0.0f });
+        expectEquals(listener.numChanges, 0);
+        expect(styleObject["transition"].isString());
+
+        styleObject.removeListener(listener);
+    }
 };
 
 static StyleSheetTest styleSheetTest;
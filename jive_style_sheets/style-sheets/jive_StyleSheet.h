@@ -1,17 +1,15 @@
 #pragma once
 
-#include "jive_StyleSelectors.h"
+#include "jive_StyleRules.h"
 
 #include <jive_components/jive_components.h>
 
 namespace jive
 {
-    template <typename Value>
-    using Styles = std::unordered_map<StyleIdentifier, Property<Value, Inheritance::doNotInherit, Accumulation::doNotAccumulate, false>>;
-
     class StyleSheet
         : public juce::ReferenceCountedObject
         , private juce::ComponentListener
+        , private StyleRules::Listener
     {
     public:
         using ReferenceCountedPointer = juce::ReferenceCountedObjectPtr<StyleSheet>;
@@ -24,13 +22,136 @@ namespace jive
         [[nodiscard]] BorderRadii<float> getBorderRadii() const;
         [[nodiscard]] juce::Font getFont() const;
 
-        [[nodiscard]] static ReferenceCountedPointer create(juce::Component& component, juce::ValueTree state);
+        /** Creates a StyleSheet for the given component.
+
+            Passing the StyleSheet of the component's parent, when it's
+            already known, saves searching up the component hierarchy for it.
+        */
+        [[nodiscard]] static ReferenceCountedPointer create(juce::Component& component,
+                                                            juce::ValueTree state,
+                                                            StyleSheet* parentStyleSheet = nullptr);
+
+        /** Returns the StyleSheet attached to the given component, if any. */
+        [[nodiscard]] static StyleSheet* findFor(const juce::Component& component);
+
+        /** The styles a StyleSheet's dependants inherit when they don't
+            specify their own.
+        */
+        struct InheritableStyles
+        {
+            enum Channel : std::uint8_t
+            {
+                foregroundChannel = 1 << 0,
+                fontFamilyChannel = 1 << 1,
+                fontSizeChannel = 1 << 2,
+                fontStretchChannel = 1 << 3,
+                fontStyleChannel = 1 << 4,
+                fontWeightChannel = 1 << 5,
+                letterSpacingChannel = 1 << 6,
+                textDecorationChannel = 1 << 7,
+                allChannels = 0xff,
+            };
+
+            Fill foreground;
+            juce::String fontFamily;
+            float fontSize;
+            float fontStretch;
+            juce::String fontStyle;
+            juce::String fontWeight;
+            float letterSpacing;
+            juce::String textDecoration;
+        };
 
     private:
-        StyleSheet(juce::Component& component, juce::ValueTree state);
+        /** The transition state of one of a StyleSheet's animatable styles.
+
+            Kept per StyleSheet rather than in the style object so that
+            reading the current value of a style never has to write to
+            anything, and so is safe to do while painting.
+        */
+        template <typename Value>
+        struct StyleAnimation
+        {
+            [[nodiscard]] Value calculateCurrent(const Value& resolvedValue) const
+            {
+                if (transition == nullptr || !target.has_value() || *target != resolvedValue)
+                    return resolvedValue;
+
+                return transition->calculateCurrent(source, *target, commencement);
+            }
+
+            [[nodiscard]] bool isInProgress() const
+            {
+                return transition != nullptr
+                    && target.has_value()
+                    && source != *target
+                    && now() < commencement + transition->delay + transition->duration;
+            }
+
+            void retarget(const Value& newTarget, const Transition* newTransition)
+            {
+                if (target != newTarget)
+                {
+                    if (target.has_value())
+                    {
+                        source = calculateCurrent(*target);
+                        commencement = now();
+                    }
+                    else
+                    {
+                        source = newTarget;
+                    }
+
+                    target = newTarget;
+                }
+
+                transition = newTransition;
+            }
+
+            Value source{};
+            std::optional<Value> target;
+            juce::Time commencement;
+            const Transition* transition = nullptr;
+        };
+
+        /** The parts of a StyleSheet that are only needed once there are
+            styles that could apply to its component. Most components in a
+            typical layout never have any, so don't pay for them.
+        */
+        struct Styling
+        {
+            explicit Styling(const juce::ValueTree& state)
+                : selectors{ state }
+                , borderWidth{ state, ids::borderWidth }
+            {
+            }
+
+            StyleSelectors selectors;
+            Property<float> borderWidth;
+            BackgroundCanvas backgroundCanvas;
+
+            StyleAnimation<Fill> backgroundAnimation;
+            StyleAnimation<Fill> foregroundAnimation;
+            StyleAnimation<Fill> borderFillAnimation;
+            StyleAnimation<BorderRadii<float>> borderRadiiAnimation;
+            StyleAnimation<float> fontSizeAnimation;
+            StyleAnimation<float> fontStretchAnimation;
+            StyleAnimation<float> letterSpacingAnimation;
+            juce::var transitionsSource;
+            Transitions::ReferenceCountedPointer transitions;
+            std::unique_ptr<Timer> animationTimer;
+            bool animationsInProgress = false;
+        };
+
+        StyleSheet(juce::Component& component,
+                   juce::ValueTree state,
+                   StyleSheet* parentStyleSheet);
 
         void componentParentHierarchyChanged(juce::Component&) final;
         void componentMovedOrResized(juce::Component&, bool, bool) final;
+        void styleValueChanged() final;
+        void styleTransitionProgressed() final;
+        void styleRulesChanged() final;
 
         [[nodiscard]] juce::String getFontFamily() const;
         [[nodiscard]] float getFontSize() const;
@@ -40,13 +161,30 @@ namespace jive
         [[nodiscard]] float getLetterSpacing() const;
         [[nodiscard]] juce::String getTextDecoration() const;
 
+        [[nodiscard]] std::uint8_t getCurrentState() const;
+        [[nodiscard]] const StyleRules::Resolution& getResolvedStyle() const;
+        [[nodiscard]] FontAttributes getFontAttributes() const;
+        [[nodiscard]] bool isFontTransitioning() const;
+        void invalidateResolvedFonts();
+
+        [[nodiscard]] const Transition* findTransition(const juce::Identifier& styleProperty) const;
+        void updateTransitions();
+        void updateAnimations();
+        void updateAnimationTimer();
+
+        [[nodiscard]] InheritableStyles getInheritableStyles() const;
+        [[nodiscard]] std::uint8_t getInheritedChannels() const;
+        void applyInheritableStyles();
+        void inheritedStylesChanged(std::uint8_t changedChannels);
+
+        void setClosestAncestor(StyleSheet* newClosestAncestor);
         void updateClosestAncestor();
-        void updateStyles(jive::Object& state, StyleIdentifier);
+        void createStyling();
+        void updateRules();
         void updateStyles();
+        void ancestorStylesChanged();
         void applyStyles();
 
-        BackgroundCanvas backgroundCanvas;
-
         juce::Component::SafePointer<juce::Component> component;
         juce::ValueTree state;
         Property<Object::ReferenceCountedPointer,
@@ -55,33 +193,17 @@ namespace jive
                  false>
             style;
         ReferenceCountedPointer closestAncestor;
-        StyleSelectors selectors;
         juce::Array<StyleSheet*> dependants;
 
 #if !JIVE_UNIT_TESTS
         const ComponentInteractionState interactionState;
 #endif
 
-        Property<float> borderWidth;
-        Styles<Fill> backgroundStyles;
-        Styles<Fill> foregroundStyles;
-        Styles<Fill> borderFillStyles;
-        Styles<BorderRadii<float>> borderRadiiStyles;
-        Styles<juce::String> fontFamilyStyles;
-        Styles<float> fontSizeStyles;
-        Styles<float> fontStretchStyles;
-        Styles<juce::String> fontStyleStyles;
-        Styles<juce::String> fontWeightStyles;
-        Styles<float> letterSpacingStyles;
-        Styles<juce::String> textDecorationStyles;
-
-        std::unique_ptr<Property<Fill>> calculatedBackground;
-        std::unique_ptr<Property<Fill>> calculatedForeground;
-        std::unique_ptr<Property<Fill>> calculatedBorderFill;
-        std::unique_ptr<Property<BorderRadii<float>>> calculatedBorderRadii;
-        std::unique_ptr<Property<float>> calculatedFontSize;
-        std::unique_ptr<Property<float>> calculatedFontStretch;
-        std::unique_ptr<Property<float>> calculatedLetterSpacing;
+        std::unique_ptr<Styling> styling;
+        StyleIndex::ReferenceCountedPointer styleIndex;
+        StyleRules::ReferenceCountedPointer rules;
+        mutable std::vector<std::optional<juce::Font>> resolvedFonts;
+        std::optional<InheritableStyles> appliedInheritableStyles;
 
         JUCE_LEAK_DETECTOR(StyleSheet)
     };
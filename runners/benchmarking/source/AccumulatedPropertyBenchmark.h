@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Benchmark.h"
+
+class AccumulatedPropertyBenchmark : public Benchmark
+{
+public:
+    AccumulatedPropertyBenchmark()
+        : Benchmark{
+            "Accumulated property - 10k nodes",
+            juce::RelativeTime::seconds(5.0),
+        }
+    {
+        for (auto i = 0; i < numBranches; i++)
+        {
+            juce::ValueTree branch{ "Component" };
+
+            for (auto j = 0; j < numLeavesPerBranch; j++)
+            {
+                juce::ValueTree leaf{ "Text" };
+
+                if (j % 100 == 0)
+                    leaf.setProperty("text", "x", nullptr);
+
+                branch.appendChild(leaf, nullptr);
+            }
+
+            root.appendChild(branch, nullptr);
+        }
+    }
+
+protected:
+    void doIteration(jive::Interpreter&) final
+    {
+        auto leaf = root
+                        .getChild(iteration % numBranches)
+                        .getChild((iteration / numBranches) % numLeavesPerBranch);
+        iteration++;
+
+        if (leaf.hasProperty("text"))
+            leaf.removeProperty("text", nullptr);
+        else
+            leaf.setProperty("text", "y", nullptr);
+
+        juce::ignoreUnused(text.get());
+        juce::ignoreUnused(text.getOr("none"));
+    }
+
+private:
+    static constexpr auto numBranches = 10;
+    static constexpr auto numLeavesPerBranch = 1000;
+
+    juce::ValueTree root{ "Component" };
+    const jive::Property<juce::String,
+                         jive::Inheritance::doNotInherit,
+                         jive::Accumulation::accumulate>
+        text{ root, "text" };
+    int iteration = 0;
+};
@@ -0,0 +1,42 @@
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<std::size_t> numBytesAllocated{ 0 };
+static std::atomic<std::size_t> numAllocations{ 0 };
+
+void* operator new(std::size_t size)
+{
+    numBytesAllocated.fetch_add(size, std::memory_order_relaxed);
+    numAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    if (auto* memory = std::malloc(size == 0 ? 1 : size))
+        return memory;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+namespace allocation_counter
+{
+    std::size_t getNumBytesAllocated() noexcept
+    {
+        return numBytesAllocated.load(std::memory_order_relaxed);
+    }
+
+    std::size_t getNumAllocations() noexcept
+    {
+        return numAllocations.load(std::memory_order_relaxed);
+    }
+} // namespace allocation_counter
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstddef>
+
+/** Counts every allocation made through the global operator new, so that
+    benchmarks can measure how much memory the objects they create use.
+*/
+namespace allocation_counter
+{
+    [[nodiscard]] std::size_t getNumBytesAllocated() noexcept;
+    [[nodiscard]] std::size_t getNumAllocations() noexcept;
+} // namespace allocation_counter
@@ -33,6 +33,11 @@ public:
 protected:
     virtual void doIteration(jive::Interpreter& interpreter) = 0;
 
+    [[nodiscard]] virtual juce::StringArray getAdditionalResults() const
+    {
+        return {};
+    }
+
 private:
     void printProgress(double progressNormalised)
     {
@@ -43,7 +48,12 @@ private:
     {
         std::cout << "\n\n"
                   << "Completed:  " << counter << " iterations\n"
-                  << "Average:    " << static_cast<double>(elapsed.inMilliseconds()) / static_cast<double>(counter) << "ms\n\n";
+                  << "Average:    " << static_cast<double>(elapsed.inMilliseconds()) / static_cast<double>(counter) << "ms\n";
+
+        for (const auto& result : getAdditionalResults())
+            std::cout << result << "\n";
+
+        std::cout << "\n";
     }
 
     void doTimeboxedRun()
@@ -5,11 +5,14 @@
 class FlexStressTest : public Benchmark
 {
 public:
-    FlexStressTest()
+    explicit FlexStressTest(bool shouldBatchUpdates = false)
         : Benchmark{
-            "jive::FlexContainer Stress Test",
+            shouldBatchUpdates
+                ? "jive::FlexContainer Stress Test - batched updates"
+                : "jive::FlexContainer Stress Test",
             juce::RelativeTime::seconds(30.0),
         }
+        , batchUpdates{ shouldBatchUpdates }
     {
     }
 
@@ -65,6 +68,11 @@ protected:
         };
         const auto item = interpreter.interpret(view);
 
+        std::optional<jive::ScopedUpdateBatch> batch;
+
+        if (batchUpdates)
+            batch.emplace(view);
+
         view.setProperty("align-content", "flex-start", nullptr);
         view.setProperty("align-content", "flex-end", nullptr);
         view.setProperty("align-content", "centre", nullptr);
@@ -99,4 +107,5 @@ protected:
     }
 
 private:
+    const bool batchUpdates;
 };
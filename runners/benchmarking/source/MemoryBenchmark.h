@@ -0,0 +1,67 @@
+#pragma once
+
+#include "AllocationCounter.h"
+#include "Benchmark.h"
+
+class MemoryBenchmark : public Benchmark
+{
+public:
+    MemoryBenchmark()
+        : Benchmark{
+            "Memory per node - 100 plain components",
+            100,
+        }
+    {
+        for (auto i = 0; i < numNodes; i++)
+        {
+            view.appendChild(juce::ValueTree{
+                                 "Component",
+                                 {
+                                     { "width", 10 },
+                                     { "height", 10 },
+                                 },
+                             },
+                             nullptr);
+        }
+    }
+
+protected:
+    void doIteration(jive::Interpreter& interpreter) final
+    {
+        const auto state = view.createCopy();
+        const auto bytesBefore = allocation_counter::getNumBytesAllocated();
+        const auto allocationsBefore = allocation_counter::getNumAllocations();
+
+        const auto item = interpreter.interpret(state);
+
+        totalBytes += allocation_counter::getNumBytesAllocated() - bytesBefore;
+        totalAllocations += allocation_counter::getNumAllocations() - allocationsBefore;
+        numViews++;
+    }
+
+    [[nodiscard]] juce::StringArray getAdditionalResults() const final
+    {
+        const auto numNodesCreated = static_cast<double>(numViews * static_cast<std::size_t>(numNodes + 1));
+
+        return {
+            "Memory:     " + juce::String{ static_cast<double>(totalBytes) / numNodesCreated, 0 } + " bytes allocated per node",
+            "            " + juce::String{ static_cast<double>(totalAllocations) / numNodesCreated, 1 } + " allocations per node",
+            "Item size:  " + juce::String{ static_cast<int>(sizeof(jive::CommonGuiItem)) } + " bytes per jive::CommonGuiItem",
+            "            " + juce::String{ static_cast<int>(sizeof(jive::BoxModel)) } + " bytes per jive::BoxModel",
+        };
+    }
+
+private:
+    static constexpr auto numNodes = 100;
+
+    juce::ValueTree view{
+        "Component",
+        {
+            { "width", 1000 },
+            { "height", 1000 },
+        },
+    };
+    std::size_t totalBytes = 0;
+    std::size_t totalAllocations = 0;
+    std::size_t numViews = 0;
+};
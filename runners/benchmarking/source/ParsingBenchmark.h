@@ -0,0 +1,56 @@
+#pragma once
+
+#include "AllocationCounter.h"
+#include "Benchmark.h"
+
+class ParsingBenchmark : public Benchmark
+{
+public:
+    ParsingBenchmark()
+        : Benchmark{
+            "Parsing colours, border sizes, points and times",
+            100000,
+        }
+    {
+    }
+
+protected:
+    void doIteration(jive::Interpreter&) final
+    {
+        const auto allocationsBefore = allocation_counter::getNumAllocations();
+
+        for (const auto& colour : colours)
+            juce::ignoreUnused(jive::parseColour(colour));
+
+        juce::ignoreUnused(juce::VariantConverter<juce::BorderSize<float>>::fromVar(borderSize));
+        juce::ignoreUnused(juce::VariantConverter<jive::BorderRadii<float>>::fromVar(borderRadii));
+        juce::ignoreUnused(juce::VariantConverter<juce::Point<float>>::fromVar(point));
+        juce::ignoreUnused(jive::parseTime(time));
+
+        totalAllocations += allocation_counter::getNumAllocations() - allocationsBefore;
+        numParses += colours.size() + 4;
+    }
+
+    [[nodiscard]] juce::StringArray getAdditionalResults() const final
+    {
+        return {
+            "Allocated:  " + juce::String{ static_cast<double>(totalAllocations) / static_cast<double>(numParses), 3 } + " allocations per parse",
+        };
+    }
+
+private:
+    const std::array<juce::String, 5> colours{
+        "#ABCDEF",
+        "#357B",
+        "rgba(127, 0, 127, 0.5)",
+        "hsl(120, 60%, 70%)",
+        "cornflowerblue",
+    };
+    const juce::var borderSize{ "1 2 3 4" };
+    const juce::var borderRadii{ "4 8" };
+    const juce::var point{ "0.5,1" };
+    const juce::String time{ "250ms" };
+
+    std::size_t totalAllocations = 0;
+    std::size_t numParses = 0;
+};
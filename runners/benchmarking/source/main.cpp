@@ -1,5 +1,8 @@
+#include "AccumulatedPropertyBenchmark.h"
 #include "FlexStressTest.h"
+#include "MemoryBenchmark.h"
 #include "MinimumViewBenchmark.h"
+#include "ParsingBenchmark.h"
 #include "StyleSheetsBenchmark.h"
 
 class BenchmarkApp : public juce::JUCEApplication
@@ -23,6 +26,10 @@ public:
         StyleSheetsQueryingBenchmark{}.run();
         MinimumViewBenchmark{}.run();
         FlexStressTest{}.run();
+        FlexStressTest{ true }.run();
+        AccumulatedPropertyBenchmark{}.run();
+        MemoryBenchmark{}.run();
+        ParsingBenchmark{}.run();
         quit();
     }
 